@@ -0,0 +1,246 @@
+#pragma once
+
+#include <MinXL/MinXL.hpp>
+
+
+namespace bench
+{
+    //
+    // Keeps the compiler from optimizing away a value the benchmark computed.
+    //
+    template <typename _Ty>
+    inline void DoNotOptimize(const _Ty& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+
+    struct Result
+    {
+        std::string     Name;
+        uint64_t        Cells;
+        uint64_t        Iterations;
+        double          NsPerOp;
+        double          NsPerCell;
+    };
+
+
+    struct Options
+    {
+        std::string     Filter;                         // Only run benchmarks whose name contains this
+        std::string     JsonPath;                       // Where to write results ("" = don't)
+        std::string     BaselinePath;                   // Previous JSON output to compare against
+        uint64_t        MaxCells    = 10'000'000;
+        double          MinTimeMs   = 50.0;             // Per repetition
+        uint64_t        Repetitions = 5;                // Best one is reported
+    };
+
+
+    //
+    // Times one benchmark body at a time and collects the results.
+    //
+    // The body runs a single operation per call. Iterations are batched until a
+    // batch takes at least MinTimeMs, and the fastest of several batches is kept,
+    // which filters out most scheduler and frequency noise.
+    //
+    class Harness
+    {
+    private:
+        Options                                         _Options;
+        std::vector<Result>                             _Results;
+        std::map<std::pair<std::string, uint64_t>, double> _Baseline;
+
+    public:
+        explicit Harness(Options options);
+
+    public:
+        bool            Enabled(std::string_view name, const uint64_t cells) const;
+
+        template <typename _Fn>
+        void            Measure(const std::string& name, const uint64_t cells, _Fn&& body);
+
+        void            Report() const;
+        void            WriteJson() const;
+
+        const Options&  Settings() const     { return _Options; }
+
+    private:
+        void            ReadBaseline();
+    };
+
+
+    inline Harness::Harness(Options options): _Options{std::move(options)}
+    {
+        if (!_Options.BaselinePath.empty())
+            ReadBaseline();
+    }
+
+
+    inline bool Harness::Enabled(std::string_view name, const uint64_t cells) const
+    {
+        return cells <= _Options.MaxCells && name.find(_Options.Filter) != std::string_view::npos;
+    }
+
+
+    template <typename _Fn>
+    inline void Harness::Measure(const std::string& name, const uint64_t cells, _Fn&& body)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        if (!Enabled(name, cells))
+            return;
+
+        auto batch = [&](const uint64_t iterations)
+        {
+            const auto start = Clock::now();
+
+            for (uint64_t i = 0; i < iterations; i++)
+                body();
+
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        };
+
+        // Grow the batch until it is long enough to time reliably
+        const double minTime = _Options.MinTimeMs * 1e6;
+        uint64_t iterations = 1;
+        double elapsed = batch(iterations);
+
+        while (elapsed < minTime)
+        {
+            const double scale = elapsed > 0 ? std::min(10.0, 1.2 * minTime / elapsed) : 10.0;
+            iterations = std::max<uint64_t>(iterations + 1, (uint64_t)(iterations * scale));
+            elapsed = batch(iterations);
+        }
+
+        double best = elapsed / iterations;
+
+        for (uint64_t rep = 1; rep < _Options.Repetitions; rep++)
+            best = std::min(best, batch(iterations) / iterations);
+
+        _Results.push_back(Result{name, cells, iterations, best, best / std::max<uint64_t>(cells, 1)});
+
+        const auto& result = _Results.back();
+        std::printf("%-44s %10" PRIu64 " cells %14.1f ns/op %10.3f ns/cell", result.Name.c_str(), result.Cells, result.NsPerOp, result.NsPerCell);
+
+        if (auto it = _Baseline.find({result.Name, result.Cells}); it != _Baseline.end())
+            std::printf("   %6.2fx vs baseline", result.NsPerOp / it->second);
+
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+
+
+    inline void Harness::Report() const
+    {
+        if (_Baseline.empty())
+            return;
+
+        double logSum = 0;
+        uint64_t matched = 0;
+
+        for (auto& result : _Results)
+        {
+            if (auto it = _Baseline.find({result.Name, result.Cells}); it != _Baseline.end())
+            {
+                logSum += std::log(result.NsPerOp / it->second);
+                matched++;
+            }
+        }
+
+        if (matched)
+            std::printf("\nGeometric mean vs baseline over %" PRIu64 " benchmarks: %.3fx (below 1 is faster)\n", matched, std::exp(logSum / matched));
+    }
+
+
+    //
+    // One benchmark per line, so that baselines can be diffed and read back
+    // without a JSON library.
+    //
+    inline void Harness::WriteJson() const
+    {
+        if (_Options.JsonPath.empty())
+            return;
+
+        std::ofstream out{_Options.JsonPath};
+
+        if (!out)
+        {
+            std::fprintf(stderr, "Could not open %s for writing\n", _Options.JsonPath.c_str());
+            return;
+        }
+
+#if defined(__VERSION__)
+        constexpr const char* compiler = __VERSION__;
+#else
+        constexpr const char* compiler = "unknown";
+#endif
+
+        out << "{\n";
+        out << "  \"context\": {\"compiler\": \"" << compiler << "\", \"pointer_size\": " << sizeof(void*)
+            << ", \"min_time_ms\": " << _Options.MinTimeMs << ", \"repetitions\": " << _Options.Repetitions << "},\n";
+        out << "  \"benchmarks\": [\n";
+
+        for (uint64_t i = 0; i < _Results.size(); i++)
+        {
+            const auto& result = _Results[i];
+            char line[512];
+
+            std::snprintf(line, sizeof(line),
+                "    {\"name\": \"%s\", \"cells\": %" PRIu64 ", \"iterations\": %" PRIu64 ", \"ns_per_op\": %.3f, \"ns_per_cell\": %.6f}%s\n",
+                result.Name.c_str(), result.Cells, result.Iterations, result.NsPerOp, result.NsPerCell, i + 1 < _Results.size() ? "," : "");
+
+            out << line;
+        }
+
+        out << "  ]\n}\n";
+    }
+
+
+    inline void Harness::ReadBaseline()
+    {
+        std::ifstream in{_Options.BaselinePath};
+
+        if (!in)
+        {
+            std::fprintf(stderr, "Could not open baseline %s\n", _Options.BaselinePath.c_str());
+            return;
+        }
+
+        auto field = [](const std::string& line, std::string_view key) -> std::string
+        {
+            const auto quoted = "\"" + std::string{key} + "\": ";
+            const auto begin = line.find(quoted);
+
+            if (begin == std::string::npos)
+                return {};
+
+            auto first = begin + quoted.size();
+            auto last = line.find_first_of(",}", first);
+
+            if (line[first] == '"')
+            {
+                first++;
+                last = line.find('"', first);
+            }
+
+            return line.substr(first, last - first);
+        };
+
+        std::string line;
+
+        while (std::getline(in, line))
+        {
+            const auto name = field(line, "name");
+            const auto cells = field(line, "cells");
+            const auto ns = field(line, "ns_per_op");
+
+            if (!name.empty() && !cells.empty() && !ns.empty())
+                _Baseline[{name, std::stoull(cells)}] = std::stod(ns);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <MinXL/MinXL.hpp>
+
+
+//
+// Arguments fabricated byte for byte the way Excel hands them to a UDF: a
+// VARIANT whose tag is followed by an inline number, a pointer to a BSTR
+// (length-prefixed UTF-16) or a pointer to a SAFEARRAY descriptor. Buffers come
+// from malloc, like the host's, so MinXL frees them through its normal paths.
+//
+namespace bench::Host
+{
+    struct RawVariant
+    {
+        uint16_t    Type;
+        uint8_t     Reserved[6];
+
+        union
+        {
+            int32_t     Int32;
+            double      Double;
+            void*       Pointer;
+        };
+
+        uint8_t     ReservedEnd[8];
+    };
+
+    static_assert(sizeof(RawVariant) == sizeof(mxl::Variant), "VARIANT layout mismatch");
+
+
+    inline mxl::Variant Adopt(const RawVariant& raw)
+    {
+        mxl::Variant value;
+        std::memcpy(static_cast<void*>(&value), &raw, sizeof(raw));
+        return value;
+    }
+
+
+    inline RawVariant Empty()
+    {
+        return RawVariant{};
+    }
+
+
+    inline RawVariant Double(const double value)
+    {
+        RawVariant raw{};
+        raw.Type = (uint16_t)mxl::Type::ID::Double;
+        raw.Double = value;
+        return raw;
+    }
+
+
+    inline RawVariant Int32(const int32_t value)
+    {
+        RawVariant raw{};
+        raw.Type = (uint16_t)mxl::Type::ID::Int32;
+        raw.Int32 = value;
+        return raw;
+    }
+
+
+    // BSTR: header with the length, then the characters and a terminator
+    inline RawVariant Bstr(std::u16string_view text)
+    {
+        const uint64_t bytes = sizeof(mxl::StringHeader) + (text.size() + 1) * sizeof(char16_t);
+        auto container = static_cast<mxl::StringContainer*>(std::malloc(bytes));
+
+        container->Header = mxl::StringHeader{};
+        container->Header.Size = (uint32_t)text.size();
+
+        std::copy(text.begin(), text.end(), container->Buffer);
+        container->Buffer[text.size()] = u'\0';
+
+        RawVariant raw{};
+        raw.Type = (uint16_t)mxl::Type::ID::String;
+        raw.Pointer = container->Buffer;
+        return raw;
+    }
+
+
+    //
+    // SAFEARRAY of VARIANTs (what Range.Value2 produces): descriptor and data
+    // are separate allocations, bounds are 1-based and cells are column-major.
+    // 'cell(row, col)' returns the RawVariant stored at each position.
+    //
+    template <typename _Fn>
+    inline RawVariant Range(const uint64_t rows, const uint64_t cols, _Fn&& cell)
+    {
+        struct Descriptor
+        {
+            mxl::ArrayHeader    Header;
+            mxl::ArrayBody      Body;
+        };
+
+        auto descriptor = static_cast<Descriptor*>(std::malloc(sizeof(Descriptor)));
+        auto data = static_cast<RawVariant*>(std::malloc(std::max<uint64_t>(rows * cols, 1) * sizeof(RawVariant)));
+
+        for (uint64_t col = 0; col < cols; col++)
+        {
+            for (uint64_t row = 0; row < rows; row++)
+                data[row + col * rows] = cell(row, col);
+        }
+
+        descriptor->Header                      = mxl::ArrayHeader{};
+        descriptor->Header.Type                 = (uint32_t)mxl::Type::ID::Variant;
+        descriptor->Body.Dims                   = 2;
+        descriptor->Body.Features               = (uint16_t)mxl::ArrayFeatures::HasVarType | (uint16_t)mxl::ArrayFeatures::ArrayOfVariants;
+        descriptor->Body.ElementSize            = sizeof(RawVariant);
+        descriptor->Body.Locks                  = 0;
+        descriptor->Body.Data                   = data;
+        descriptor->Body.Columns.ElementCount   = (uint32_t)cols;
+        descriptor->Body.Columns.LowerBound     = 1;
+        descriptor->Body.Rows.ElementCount      = (uint32_t)rows;
+        descriptor->Body.Rows.LowerBound        = 1;
+
+        RawVariant raw{};
+        raw.Type = (uint16_t)mxl::Type::GetID<mxl::Array<mxl::Variant>>();
+        raw.Pointer = &descriptor->Body;
+        return raw;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,369 @@
+#include "Harness.hpp"
+#include "Host.hpp"
+
+
+using namespace mxl;
+
+
+namespace
+{
+    // Cell counts from a single cell up to a 10M-cell column
+    constexpr uint64_t Sizes[] = {1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+
+    Array<Variant> HostNumbers(const uint64_t rows)
+    {
+        return Array<Variant>{bench::Host::Adopt(bench::Host::Range(rows, 1, [](uint64_t row, uint64_t)
+        {
+            return bench::Host::Double(row * 0.5);
+        }))};
+    }
+
+
+    Array<Variant> HostIntegers(const uint64_t rows)
+    {
+        return Array<Variant>{bench::Host::Adopt(bench::Host::Range(rows, 1, [](uint64_t row, uint64_t)
+        {
+            return bench::Host::Int32((int32_t)(row % 1000));
+        }))};
+    }
+
+
+    Array<Variant> HostStrings(const uint64_t rows)
+    {
+        static constexpr std::u16string_view words[] = {u"alpha", u"beta", u"gamma", u"delta", u"epsilon (ε)", u"zeta", u"eta", u"theta"};
+
+        return Array<Variant>{bench::Host::Adopt(bench::Host::Range(rows, 1, [](uint64_t row, uint64_t)
+        {
+            return bench::Host::Bstr(words[row % std::size(words)]);
+        }))};
+    }
+
+
+    void Construction(bench::Harness& harness, const uint64_t cells)
+    {
+        harness.Measure("Variant/Construct/Double", cells, [&]
+        {
+            for (uint64_t i = 0; i < cells; i++)
+            {
+                Variant value{(double)i};
+                bench::DoNotOptimize(value);
+            }
+        });
+
+        harness.Measure("Variant/Construct/String", cells, [&]
+        {
+            for (uint64_t i = 0; i < cells; i++)
+            {
+                Variant value{u"benchmark"};
+                bench::DoNotOptimize(value);
+            }
+        });
+
+        harness.Measure("Array<Variant>/Construct", cells, [&]
+        {
+            Array<Variant> array(cells, 1);
+            bench::DoNotOptimize(array);
+        });
+
+        harness.Measure("Array<double>/Construct", cells, [&]
+        {
+            Array<double> array(cells, 1);
+            bench::DoNotOptimize(array);
+        });
+
+        // A UDF result written into the caller's already shaped ByRef array
+        Variant output;
+
+        harness.Measure("PrepareOutput<double>/Reuse", cells, [&]
+        {
+            auto& array = PrepareOutput<double>(output, cells, 1);
+            bench::DoNotOptimize(array);
+        });
+    }
+
+
+    void CopyAndMove(bench::Harness& harness, const uint64_t cells, const Array<Variant>& numbers, const Array<Variant>& strings)
+    {
+        harness.Measure("Array<Variant>/Copy/Numbers", cells, [&]
+        {
+            Array<Variant> copy{numbers};
+            bench::DoNotOptimize(copy);
+        });
+
+        // Inside an arena, so the copied strings are released every iteration
+        harness.Measure("Array<Variant>/Copy/Strings", cells, [&]
+        {
+            ArenaScope arena;
+            Array<Variant> copy{strings};
+            bench::DoNotOptimize(copy);
+        });
+
+        // Leaves the input intact while changing 1% of it (one contiguous range)
+        harness.Measure("BorrowedArray<Variant>/Write1Percent", cells, [&]
+        {
+            BorrowedArray<Variant> borrowed{numbers};
+
+            for (uint64_t i = 0; i < cells / 100; i++)
+                borrowed.Write(i) = 0.0;
+
+            bench::DoNotOptimize(borrowed);
+        });
+
+        Array<double> doubles(cells, 1);
+
+        harness.Measure("Array<double>/Copy", cells, [&]
+        {
+            Array<double> copy{doubles};
+            bench::DoNotOptimize(copy);
+        });
+
+        // What a UDF does with its argument and its result (README example)
+        Variant argument{Array<Variant>{numbers}};
+
+        harness.Measure("Variant/Move/ArrayRoundTrip", cells, [&]
+        {
+            Array<Variant> array = std::move(argument);
+            argument = Variant{std::move(array)};
+            bench::DoNotOptimize(argument);
+        });
+    }
+
+
+    void Arithmetic(bench::Harness& harness, const uint64_t cells, const Array<Variant>& numbers, const Array<Variant>& integers)
+    {
+        Array<Variant> target{numbers};
+
+        harness.Measure("Variant/AddAssign/Double", cells, [&]
+        {
+            for (auto& cell : target)
+                cell += 2.5;
+
+            bench::DoNotOptimize(target);
+        });
+
+        Array<Variant> result(cells, 1);
+
+        harness.Measure("Variant/Add/Int32+Double", cells, [&]
+        {
+            for (uint64_t i = 0; i < cells; i++)
+                result[i] = integers[i] + numbers[i];
+
+            bench::DoNotOptimize(result);
+        });
+
+        harness.Measure("Variant/Multiply/Double*Double", cells, [&]
+        {
+            for (uint64_t i = 0; i < cells; i++)
+                result[i] = numbers[i] * numbers[i];
+
+            bench::DoNotOptimize(result);
+        });
+
+        harness.Measure("Variant/Compare/Int32<Double", cells, [&]
+        {
+            uint64_t count = 0;
+
+            for (uint64_t i = 0; i < cells; i++)
+                count += integers[i] < numbers[i];
+
+            bench::DoNotOptimize(count);
+        });
+    }
+
+
+    void Strings(bench::Harness& harness, const uint64_t cells, const Array<Variant>& strings)
+    {
+        harness.Measure("String/ToUtf8", cells, [&]
+        {
+            for (uint64_t i = 0; i < cells; i++)
+            {
+                auto utf8 = static_cast<const String&>(strings[i]).Utf8();
+                bench::DoNotOptimize(utf8);
+            }
+        });
+
+        harness.Measure("String/EncodeUtf8Column", cells, [&]
+        {
+            auto column = EncodeUtf8(strings, 0);
+            bench::DoNotOptimize(column);
+        });
+
+        std::vector<std::string> utf8(cells);
+
+        for (uint64_t i = 0; i < cells; i++)
+            utf8[i] = static_cast<const String&>(strings[i]).Utf8();
+
+        harness.Measure("String/FromUtf8", cells, [&]
+        {
+            for (uint64_t i = 0; i < cells; i++)
+            {
+                String text{std::string_view{utf8[i]}};
+                bench::DoNotOptimize(text);
+            }
+        });
+    }
+
+
+    void Resizing(bench::Harness& harness, const uint64_t cells, const Array<Variant>& numbers)
+    {
+        Array<Variant> variants{numbers};
+
+        harness.Measure("Array<Variant>/Resize/GrowShrink", cells, [&]
+        {
+            variants.Resize(cells * 2, 1);
+            variants.Resize(cells, 1);
+            bench::DoNotOptimize(variants);
+        });
+
+        Array<double> doubles(cells, 1);
+
+        harness.Measure("Array<double>/Resize/GrowShrink", cells, [&]
+        {
+            doubles.Resize(cells * 2, 1);
+            doubles.Resize(cells, 1);
+            bench::DoNotOptimize(doubles);
+        });
+
+        // Output of unknown length, e.g. a filter
+        harness.Measure("ArrayBuilder<double>/Append", cells, [&]
+        {
+            ArrayBuilder<double> builder;
+
+            for (uint64_t i = 0; i < cells; i++)
+                builder.Append((double)i);
+
+            auto array = builder.Finish();
+            bench::DoNotOptimize(array);
+        });
+    }
+
+
+    void Iteration(bench::Harness& harness, const uint64_t cells, const Array<Variant>& numbers)
+    {
+        harness.Measure("Array<Variant>/Iterate/Sum", cells, [&]
+        {
+            double sum = 0;
+
+            for (auto& cell : numbers)
+                sum += static_cast<const double&>(cell);
+
+            bench::DoNotOptimize(sum);
+        });
+
+        harness.Measure("Array<Variant>/Iterate/ColumnView", cells, [&]
+        {
+            double sum = 0;
+
+            for (auto& cell : numbers.ColumnView(0))
+                sum += static_cast<const double&>(cell);
+
+            bench::DoNotOptimize(sum);
+        });
+
+        std::vector<double> unboxed(cells);
+
+        harness.Measure("Array<Variant>/Unbox", cells, [&]
+        {
+            numbers.Unbox(unboxed.data(), UnboxPolicy::Zero);
+            bench::DoNotOptimize(unboxed);
+        });
+
+        Array<double> doubles(cells, 1);
+
+        harness.Measure("Array<double>/Iterate/Sum", cells, [&]
+        {
+            double sum = 0;
+
+            for (auto value : doubles)
+                sum += value;
+
+            bench::DoNotOptimize(sum);
+        });
+    }
+
+
+    void Transposition(bench::Harness& harness, const uint64_t cells)
+    {
+        // A block 50 columns wide, as handed to row-major numeric libraries
+        const uint64_t cols = std::min<uint64_t>(cells, 50);
+
+        Array<double> doubles(cells / cols, cols);
+        std::vector<double> rowMajor(doubles.Size());
+
+        harness.Measure("Array<double>/ToRowMajor", doubles.Size(), [&]
+        {
+            doubles.ToRowMajor(rowMajor.data());
+            bench::DoNotOptimize(rowMajor);
+        });
+
+        harness.Measure("Array<double>/FromRowMajor", doubles.Size(), [&]
+        {
+            doubles.FromRowMajor(rowMajor.data());
+            bench::DoNotOptimize(doubles);
+        });
+    }
+
+
+    void Usage()
+    {
+        std::printf(
+            "Usage: MinXLBenchmarks [options]\n"
+            "  --filter <text>       Only run benchmarks whose name contains <text>\n"
+            "  --max-cells <n>       Skip sizes above <n> cells (default 10000000)\n"
+            "  --min-time <ms>       Minimum time per repetition (default 50)\n"
+            "  --repetitions <n>     Repetitions per benchmark, best is kept (default 5)\n"
+            "  --json <path>         Write results as JSON\n"
+            "  --baseline <path>     Compare against a previous --json output\n"
+        );
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    bench::Options options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--filter" && hasValue)              options.Filter = argv[++i];
+        else if (arg == "--max-cells" && hasValue)      options.MaxCells = std::stoull(argv[++i]);
+        else if (arg == "--min-time" && hasValue)       options.MinTimeMs = std::stod(argv[++i]);
+        else if (arg == "--repetitions" && hasValue)    options.Repetitions = std::max<uint64_t>(1, std::stoull(argv[++i]));
+        else if (arg == "--json" && hasValue)           options.JsonPath = argv[++i];
+        else if (arg == "--baseline" && hasValue)       options.BaselinePath = argv[++i];
+        else
+        {
+            Usage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    bench::Harness harness{options};
+
+    for (auto cells : Sizes)
+    {
+        if (cells > options.MaxCells)
+            break;
+
+        const auto numbers = HostNumbers(cells);
+        const auto integers = HostIntegers(cells);
+        const auto strings = HostStrings(cells);
+
+        Construction(harness, cells);
+        CopyAndMove(harness, cells, numbers, strings);
+        Arithmetic(harness, cells, numbers, integers);
+        Strings(harness, cells, strings);
+        Resizing(harness, cells, numbers);
+        Iteration(harness, cells, numbers);
+        Transposition(harness, cells);
+    }
+
+    harness.Report();
+    harness.WriteJson();
+
+    return 0;
+}
\ No newline at end of file
@@ -9,6 +9,9 @@
 // Location within source code (without file full path)
 #define MXL_WHERE Detail::StripPath("file " __FILE__ ", line " MXL_STRINGIFY_EXPR(__LINE__))
 
+// Failure description, for returning instead of throwing (see mxl::Result)
+#define MXL_FAILURE(msg) mxl::Failure{msg, MXL_WHERE}
+
 // Exception throw
 #define MXL_THROW(msg) throw mxl::Exception{msg, MXL_WHERE}
 
@@ -24,22 +27,51 @@ namespace mxl
     }
 
 
+    //
+    // Why an operation failed: a message and the source location that reported
+    // it. Both are expected to be string literals (as MXL_FAILURE and MXL_THROW
+    // pass them), so a Failure is just two pointers and costs nothing to create.
+    //
+    struct Failure
+    {
+        const char* Message;
+        const char* Where;
+    };
+
+
+    //
+    // Keeps only the static message and location of the failure, so throwing
+    // never allocates. The full text returned by what() is formatted into an
+    // inline buffer when the exception is created, so what() only reads it
+    // and may be called from several threads at once.
+    //
     class Exception: public std::exception
     {
-        char* m_What;
+        Failure _Failure;
+        char    _What[256];
+
+        void Format() noexcept
+        {
+            std::snprintf(_What, sizeof(_What), "[MinXL] Exception: %s (at %s)", _Failure.Message, _Failure.Where);
+        }
 
     public:
-        Exception(const char* message, const char* file_line)
+        Exception(const char* message, const char* file_line): _Failure{message, file_line}
         {
-            auto nLength = std::strlen(message) + std::strlen(file_line) + 32;
-            m_What = new char[nLength];
+            Format();
+        }
 
-            std::snprintf(m_What, nLength, "[MinXL] Exception: %s (at %s)", message, file_line);
+        explicit Exception(const Failure& failure): _Failure{failure}
+        {
+            Format();
         }
 
         const char* what() const noexcept override
         {
-            return m_What;
+            return _What;
         }
+
+        const char* Message() const noexcept    { return _Failure.Message; }
+        const char* Where() const noexcept      { return _Failure.Where; }
     };
 }
\ No newline at end of file
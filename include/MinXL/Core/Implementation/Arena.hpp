@@ -0,0 +1,439 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    inline Arena::Arena(const uint64_t blockSize): _Current{0}, _BlockSize{blockSize}
+    {
+    }
+
+
+    inline Arena::~Arena()
+    {
+        for (auto& block : _Blocks)
+        {
+            Withdraw(block);
+            std::free(block.Data);
+        }
+    }
+
+
+    //
+    // Returns 16-byte aligned memory (the alignment malloc guarantees on macOS).
+    //
+    inline void* Arena::Allocate(const uint64_t size)
+    {
+        constexpr uint64_t alignment = 16;
+
+        const uint64_t rounded = (size + alignment - 1) & ~(alignment - 1);
+
+        // Move forward through retained blocks until one fits
+        for (; _Current < _Blocks.size(); _Current++)
+        {
+            auto& block = _Blocks[_Current];
+
+            if (block.Used + rounded <= block.Capacity)
+            {
+                auto ptr = block.Data + block.Used;
+                block.Used += rounded;
+
+                return ptr;
+            }
+        }
+
+        const uint64_t capacity = std::max(_BlockSize, rounded);
+        auto data = static_cast<std::byte*>(std::malloc(capacity));
+
+        if (!data)
+            return nullptr;
+
+        const Block block{data, capacity, rounded};
+
+        if (!Publish(block))
+        {
+            std::free(data);
+            return nullptr;
+        }
+
+        _Blocks.push_back(block);
+        _Current = _Blocks.size() - 1;
+
+        return data;
+    }
+
+
+    inline bool Arena::Owns(const void* ptr) const
+    {
+        auto p = static_cast<const std::byte*>(ptr);
+
+        for (auto& block : _Blocks)
+        {
+            if (p >= block.Data && p < block.Data + block.Capacity)
+                return true;
+        }
+
+        return false;
+    }
+
+
+    inline Arena::Mark Arena::GetMark() const
+    {
+        if (_Current < _Blocks.size())
+            return Mark{_Current, _Blocks[_Current].Used};
+
+        return Mark{_Current, 0};
+    }
+
+
+    //
+    // Releases everything allocated after 'mark'. Blocks are kept for reuse.
+    //
+    inline void Arena::Rewind(const Mark& mark)
+    {
+        for (uint64_t i = mark.Block; i < _Blocks.size(); i++)
+            _Blocks[i].Used = (i == mark.Block) ? mark.Used : 0;
+
+        _Current = mark.Block;
+    }
+
+
+    inline void Arena::Reset()
+    {
+        Rewind(Mark{0, 0});
+    }
+
+
+    inline uint64_t Arena::BytesUsed() const
+    {
+        uint64_t used = 0;
+
+        for (auto& block : _Blocks)
+            used += block.Used;
+
+        return used;
+    }
+
+
+    inline uint64_t Arena::BytesReserved() const
+    {
+        uint64_t reserved = 0;
+
+        for (auto& block : _Blocks)
+            reserved += block.Capacity;
+
+        return reserved;
+    }
+
+
+    inline Arena::Bypass::Bypass(): _Saved{Arena::_Active}
+    {
+        Arena::_Active = nullptr;
+    }
+
+
+    inline Arena::Bypass::~Bypass()
+    {
+        Arena::_Active = _Saved;
+    }
+
+
+    inline Arena* Arena::Active()
+    {
+        return _Active;
+    }
+
+
+    inline Arena& Arena::ThreadLocal()
+    {
+        static thread_local Arena arena;
+        return arena;
+    }
+
+
+    inline std::mutex& Arena::RegistryLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
+
+    inline bool Arena::Publish(const Block& block)
+    {
+        std::lock_guard lock{RegistryLock()};
+
+        const uint64_t count = _RangeCount.load(std::memory_order_relaxed);
+        uint64_t slot = 0;
+
+        // Reuse a withdrawn slot before extending the table
+        while (slot < count && _Ranges[slot].Begin.load(std::memory_order_relaxed) != 0)
+            slot++;
+
+        if (slot == MaxBlocks)
+            return false;
+
+        auto& range = _Ranges[slot];
+        const uint64_t version = range.Version.load(std::memory_order_relaxed);
+
+        // Sequentially consistent, so no reader can see the new range
+        // without also seeing the odd version in front of it
+        range.Version.store(version + 1);
+        range.End.store((uintptr_t)(block.Data + block.Capacity));
+        range.Begin.store((uintptr_t)block.Data);
+        range.Version.store(version + 2);
+
+        if (slot == count)
+            _RangeCount.store(count + 1, std::memory_order_release);
+
+        return true;
+    }
+
+
+    inline void Arena::Withdraw(const Block& block)
+    {
+        std::lock_guard lock{RegistryLock()};
+
+        const uint64_t count = _RangeCount.load(std::memory_order_relaxed);
+
+        for (uint64_t slot = 0; slot < count; slot++)
+        {
+            auto& range = _Ranges[slot];
+
+            if (range.Begin.load(std::memory_order_relaxed) != (uintptr_t)block.Data)
+                continue;
+
+            const uint64_t version = range.Version.load(std::memory_order_relaxed);
+
+            range.Version.store(version + 1);
+            range.Begin.store(0);
+            range.End.store(0);
+            range.Version.store(version + 2);
+
+            return;
+        }
+    }
+
+
+    inline bool Arena::IsLive(const void* ptr)
+    {
+        const auto address = (uintptr_t)ptr;
+        const uint64_t count = _RangeCount.load(std::memory_order_acquire);
+
+        for (uint64_t slot = 0; slot < count; slot++)
+        {
+            auto& range = _Ranges[slot];
+
+            uintptr_t begin, end;
+            uint64_t version;
+
+            do
+            {
+                version = range.Version.load();
+                begin   = range.Begin.load();
+                end     = range.End.load();
+            }
+            while ((version & 1) || version != range.Version.load());
+
+            if (begin && address >= begin && address < end)
+                return true;
+        }
+
+        return false;
+    }
+
+
+    inline ArenaScope::ArenaScope()
+        : _Arena{Arena::ThreadLocal()}, _Previous{Arena::_Active}, _Mark{_Arena.GetMark()}
+    {
+        Arena::_Active = &_Arena;
+        Arena::_ActiveScopes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+
+    inline ArenaScope::~ArenaScope()
+    {
+        _Arena.Rewind(_Mark);
+
+        Arena::_Active = _Previous;
+        Arena::_ActiveScopes.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+
+    //
+    // Returns a Variant whose storage (string, array header, array data and every
+    // nested string) lives in malloc memory. Values that never touched the arena
+    // are moved through untouched.
+    //
+    inline Variant ArenaScope::Promote(Variant&& value)
+    {
+        if (!Detail::IsArenaBacked(value))
+            return std::move(value);
+
+        // The deep copy must go to the C heap
+        Arena::Bypass bypass;
+
+        return Variant{static_cast<const Variant&>(value)};
+    }
+
+
+    inline String ArenaScope::Promote(String&& value)
+    {
+        if (!Detail::IsArenaMemory(value.Buffer()))
+            return std::move(value);
+
+        Arena::Bypass bypass;
+
+        return String{static_cast<const String&>(value)};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline Array<_Ty> ArenaScope::Promote(Array<_Ty>&& value)
+    {
+        bool backed = Detail::IsArenaMemory(value.Data());
+
+        if constexpr (Type::IsSame<_Ty, Variant>)
+        {
+            for (uint64_t i = 0; i < value.Size() && !backed; i++)
+                backed = Detail::IsArenaBacked(value[i]);
+        }
+
+        if (!backed)
+            return std::move(value);
+
+        Arena::Bypass bypass;
+
+        return Array<_Ty>{static_cast<const Array<_Ty>&>(value)};
+    }
+
+
+    namespace Detail
+    {
+        inline void* Malloc(const uint64_t size)
+        {
+            if (auto arena = Arena::Active())
+                return arena->Allocate(size);
+
+            return std::malloc(size);
+        }
+
+
+        inline void* Calloc(const uint64_t count, const uint64_t size)
+        {
+            if (auto arena = Arena::Active())
+            {
+                // Same contract as calloc: a product that overflows is a failure
+                if (size && count > UINT64_MAX / size)
+                    return nullptr;
+
+                auto ptr = arena->Allocate(count * size);
+
+                if (ptr)
+                    std::memset(ptr, 0, count * size);
+
+                return ptr;
+            }
+
+            return std::calloc(count, size);
+        }
+
+
+        //
+        // Resizes a block of 'size' bytes to 'newSize', keeping its contents.
+        // Heap blocks go through realloc (which can often grow or shrink in
+        // place); arena blocks can't be resized, so they are moved instead.
+        //
+        inline void* Realloc(void* ptr, const uint64_t size, const uint64_t newSize)
+        {
+            if (!ptr)
+                return Malloc(newSize);
+
+            if (IsArenaMemory(ptr))
+            {
+                auto moved = Malloc(newSize);
+
+                if (moved)
+                    std::memcpy(moved, ptr, std::min(size, newSize));
+
+                return moved;
+            }
+
+            return std::realloc(ptr, std::max<uint64_t>(newSize, 1));
+        }
+
+
+        inline void Free(void* ptr)
+        {
+            if (ptr && !IsArenaMemory(ptr))
+                std::free(ptr);
+        }
+
+
+        inline bool IsArenaMemory(const void* ptr)
+        {
+            if (!ptr || Arena::_ActiveScopes.load(std::memory_order_relaxed) == 0)
+                return false;
+
+            // Common case: memory from this thread's own arena, whose blocks only
+            // this thread changes
+            if (auto arena = Arena::Active(); arena && arena->Owns(ptr))
+                return true;
+
+            // Memory may have been handed over from another thread's arena
+            return Arena::IsLive(ptr);
+        }
+
+
+        inline bool IsArenaBacked(const Variant& value)
+        {
+            if (value.IsString())
+                return IsArenaMemory(static_cast<const String&>(value).Buffer());
+
+            if (!value.IsArray())
+                return false;
+
+            // The Array object itself is the separately allocated header
+            auto backed = [](const auto& array)
+            {
+                return IsArenaMemory(&array) || IsArenaMemory(array.Data());
+            };
+
+            switch (value.ArrayTypeID())
+            {
+                case Type::ID::Int16:   return backed(static_cast<const Array<int16_t>&>(value));
+                case Type::ID::Int32:   return backed(static_cast<const Array<int32_t>&>(value));
+                case Type::ID::Int64:   return backed(static_cast<const Array<int64_t>&>(value));
+                case Type::ID::Float:   return backed(static_cast<const Array<float>&>(value));
+                case Type::ID::Double:  return backed(static_cast<const Array<double>&>(value));
+                case Type::ID::Bool:    return backed(static_cast<const Array<Bool>&>(value));
+                case Type::ID::Byte:    return backed(static_cast<const Array<Byte>&>(value));
+                case Type::ID::Date:    return backed(static_cast<const Array<Date>&>(value));
+
+                case Type::ID::Variant:
+                {
+                    auto& array = static_cast<const Array<Variant>&>(value);
+
+                    if (backed(array))
+                        return true;
+
+                    for (uint64_t i = 0; i < array.Size(); i++)
+                    {
+                        if (IsArenaBacked(array[i]))
+                            return true;
+                    }
+
+                    return false;
+                }
+
+                default:
+                    return false;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -1,11 +1,258 @@
 #pragma once
 
 #include "MinXL/Core/Types.hpp"
+#include "MinXL/Core/Interface/Arena.hpp"
 #include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
 
 
 namespace mxl
 {
+    namespace Detail
+    {
+        //
+        // Value of a cell as a number for conversion into a typed Array: numbers
+        // as they are, Booleans as -1/0 (as in VBA), Dates as their serial and
+        // Empty as 0. Anything else can't be converted.
+        //
+        inline double CellNumber(const Variant& cell)
+        {
+            switch (cell.TypeID())
+            {
+                case Type::ID::Empty:   return 0.0;
+                case Type::ID::Int16:   return static_cast<const int16_t&>(cell);
+                case Type::ID::Int32:   return static_cast<const int32_t&>(cell);
+                case Type::ID::Int64:   return (double)static_cast<const int64_t&>(cell);
+                case Type::ID::Float:   return static_cast<const float&>(cell);
+                case Type::ID::Double:  return static_cast<const double&>(cell);
+                case Type::ID::Bool:    return static_cast<const Bool&>(cell) ? -1.0 : 0.0;
+                case Type::ID::Byte:    return static_cast<const Byte&>(cell);
+                case Type::ID::Date:    return static_cast<const Date&>(cell).Value;
+
+                default:
+                    MXL_THROW("Invalid conversion; Variant is not a number, Boolean or Date");
+            }
+        }
+
+
+        //
+        // Converts a cell into a typed Array element. Integers round half to
+        // even and must fit the element type, as with VBA's CInt, CByte, etc.
+        //
+        template <ArrayValue _Ty>
+        inline _Ty CellAs(const Variant& cell)
+        {
+            if (cell.TypeID() == Type::GetID<_Ty>())
+                return static_cast<const _Ty&>(cell);
+
+            const double value = CellNumber(cell);
+
+            if constexpr (Type::IsSame<_Ty, Bool>)
+                return Bool{value != 0.0};
+            else if constexpr (Type::IsSame<_Ty, Date>)
+                return Date{value};
+            else if constexpr (std::is_floating_point_v<_Ty>)
+                return (_Ty)value;
+            else
+            {
+                const double rounded = std::nearbyint(value);
+
+                if (!(rounded >= (double)std::numeric_limits<_Ty>::min() && rounded < (double)std::numeric_limits<_Ty>::max() + 1.0))
+                    MXL_THROW("Invalid conversion; value out of range of the Array element type");
+
+                return (_Ty)rounded;
+            }
+        }
+
+
+        // Side of the square tiles the transposes work on: a tile of the source
+        // plus one of the destination stay well inside L1
+        template <typename _Ty>
+        inline constexpr uint64_t TransposeTileSize = sizeof(_Ty) <= 2 ? 64 : sizeof(_Ty) <= 8 ? 32 : 16;
+
+
+        //
+        // Transposes one tile of at most TransposeTileSize x TransposeTileSize:
+        // element (r, c) is read from in[r + c * inStride] and written to
+        // out[c + r * outStride]. Doubles go through 2x2 and floats through 4x4
+        // register transposes; the ragged edges are copied one by one.
+        //
+        template <typename _Ty>
+        inline void TransposeTile(const _Ty* in, const uint64_t inStride, _Ty* out, const uint64_t outStride, const uint64_t rows, const uint64_t cols)
+        {
+            uint64_t fullRows = 0;
+            uint64_t fullCols = 0;
+
+#if defined(__SSE2__)
+            if constexpr (Type::IsSame<_Ty, double>)
+            {
+                fullRows = rows & ~1ull;
+                fullCols = cols & ~1ull;
+
+                for (uint64_t c = 0; c < fullCols; c += 2)
+                {
+                    for (uint64_t r = 0; r < fullRows; r += 2)
+                    {
+                        const __m128d a = _mm_loadu_pd(&in[r + c * inStride]);
+                        const __m128d b = _mm_loadu_pd(&in[r + (c + 1) * inStride]);
+
+                        _mm_storeu_pd(&out[c + r * outStride],       _mm_unpacklo_pd(a, b));
+                        _mm_storeu_pd(&out[c + (r + 1) * outStride], _mm_unpackhi_pd(a, b));
+                    }
+                }
+            }
+            else if constexpr (Type::IsSame<_Ty, float>)
+            {
+                fullRows = rows & ~3ull;
+                fullCols = cols & ~3ull;
+
+                for (uint64_t c = 0; c < fullCols; c += 4)
+                {
+                    for (uint64_t r = 0; r < fullRows; r += 4)
+                    {
+                        __m128 a = _mm_loadu_ps(&in[r + c * inStride]);
+                        __m128 b = _mm_loadu_ps(&in[r + (c + 1) * inStride]);
+                        __m128 d = _mm_loadu_ps(&in[r + (c + 2) * inStride]);
+                        __m128 e = _mm_loadu_ps(&in[r + (c + 3) * inStride]);
+
+                        _MM_TRANSPOSE4_PS(a, b, d, e);
+
+                        _mm_storeu_ps(&out[c + r * outStride],       a);
+                        _mm_storeu_ps(&out[c + (r + 1) * outStride], b);
+                        _mm_storeu_ps(&out[c + (r + 2) * outStride], d);
+                        _mm_storeu_ps(&out[c + (r + 3) * outStride], e);
+                    }
+                }
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            if constexpr (Type::IsSame<_Ty, double>)
+            {
+                fullRows = rows & ~1ull;
+                fullCols = cols & ~1ull;
+
+                for (uint64_t c = 0; c < fullCols; c += 2)
+                {
+                    for (uint64_t r = 0; r < fullRows; r += 2)
+                    {
+                        const float64x2_t a = vld1q_f64(&in[r + c * inStride]);
+                        const float64x2_t b = vld1q_f64(&in[r + (c + 1) * inStride]);
+
+                        vst1q_f64(&out[c + r * outStride],       vzip1q_f64(a, b));
+                        vst1q_f64(&out[c + (r + 1) * outStride], vzip2q_f64(a, b));
+                    }
+                }
+            }
+            else if constexpr (Type::IsSame<_Ty, float>)
+            {
+                fullRows = rows & ~3ull;
+                fullCols = cols & ~3ull;
+
+                for (uint64_t c = 0; c < fullCols; c += 4)
+                {
+                    for (uint64_t r = 0; r < fullRows; r += 4)
+                    {
+                        const float32x4_t a = vld1q_f32(&in[r + c * inStride]);
+                        const float32x4_t b = vld1q_f32(&in[r + (c + 1) * inStride]);
+                        const float32x4_t d = vld1q_f32(&in[r + (c + 2) * inStride]);
+                        const float32x4_t e = vld1q_f32(&in[r + (c + 3) * inStride]);
+
+                        // Swap 1x1 elements within pairs, then 2x2 pairs
+                        const float64x2_t ab0 = vreinterpretq_f64_f32(vtrn1q_f32(a, b));
+                        const float64x2_t ab1 = vreinterpretq_f64_f32(vtrn2q_f32(a, b));
+                        const float64x2_t de0 = vreinterpretq_f64_f32(vtrn1q_f32(d, e));
+                        const float64x2_t de1 = vreinterpretq_f64_f32(vtrn2q_f32(d, e));
+
+                        vst1q_f32(&out[c + r * outStride],       vreinterpretq_f32_f64(vzip1q_f64(ab0, de0)));
+                        vst1q_f32(&out[c + (r + 1) * outStride], vreinterpretq_f32_f64(vzip1q_f64(ab1, de1)));
+                        vst1q_f32(&out[c + (r + 2) * outStride], vreinterpretq_f32_f64(vzip2q_f64(ab0, de0)));
+                        vst1q_f32(&out[c + (r + 3) * outStride], vreinterpretq_f32_f64(vzip2q_f64(ab1, de1)));
+                    }
+                }
+            }
+#endif
+
+            for (uint64_t c = 0; c < cols; c++)
+            {
+                // Rows below the vector part, then (for the vector rows) the columns right of it
+                for (uint64_t r = c < fullCols ? fullRows : 0; r < rows; r++)
+                    out[c + r * outStride] = in[r + c * inStride];
+            }
+        }
+
+
+        //
+        // Transposes a rows x cols matrix, stored with element (r, c) at
+        // in[r + c * inStride], into out[c + r * outStride]. Going tile by tile
+        // keeps both the strided reads and the strided writes inside a few
+        // cache lines at a time, instead of touching a new line per element.
+        //
+        // The same call turns a column-major Array into a row-major buffer and,
+        // with the roles of rows and columns swapped, a row-major buffer back.
+        //
+        template <typename _Ty>
+        inline void Transpose(const _Ty* in, const uint64_t inStride, _Ty* out, const uint64_t outStride, const uint64_t rows, const uint64_t cols)
+        {
+            constexpr uint64_t tile = TransposeTileSize<_Ty>;
+
+            for (uint64_t r = 0; r < rows; r += tile)
+            {
+                for (uint64_t c = 0; c < cols; c += tile)
+                {
+                    TransposeTile(&in[r + c * inStride], inStride, &out[c + r * outStride], outStride,
+                        std::min(tile, rows - r), std::min(tile, cols - c));
+                }
+            }
+        }
+
+
+        //
+        // Transposes the n x n matrix 'data' in place, one pair of mirrored
+        // tiles at a time. Plain element types bounce each tile through a small
+        // stack buffer so the vector kernels can do the work; Variants are
+        // swapped cell by cell.
+        //
+        template <typename _Ty>
+        inline void TransposeSquare(_Ty* data, const uint64_t n)
+        {
+            constexpr uint64_t tile = TransposeTileSize<_Ty>;
+
+            for (uint64_t r = 0; r < n; r += tile)
+            {
+                for (uint64_t c = r; c < n; c += tile)
+                {
+                    const uint64_t rows = std::min(tile, n - r);
+                    const uint64_t cols = std::min(tile, n - c);
+
+                    _Ty* upper = &data[r + c * n];      // Rows r.., columns c..
+                    _Ty* lower = &data[c + r * n];      // Its mirror image
+
+                    if constexpr (std::is_trivially_copyable_v<_Ty>)
+                    {
+                        _Ty buffer[tile * tile];
+
+                        // 'upper' (rows x cols) goes to the buffer, column-major with stride 'tile'
+                        for (uint64_t j = 0; j < cols; j++)
+                            std::memcpy(&buffer[j * tile], &upper[j * n], rows * sizeof(_Ty));
+
+                        if (upper != lower)
+                            TransposeTile(lower, n, upper, n, cols, rows);
+
+                        TransposeTile(buffer, tile, lower, n, rows, cols);
+                    }
+                    else
+                    {
+                        for (uint64_t j = 0; j < cols; j++)
+                        {
+                            for (uint64_t i = (upper == lower) ? j + 1 : 0; i < rows; i++)
+                                std::swap(upper[i + j * n], lower[j + i * n]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+
     template<ArrayValue _Ty>
     inline Array<_Ty>::Array(): _Header{}, _Body{}
     {
@@ -19,16 +266,23 @@ namespace mxl
 
 
     template<ArrayValue _Ty>
-    inline Array<_Ty>::Array(const Array<_Ty>& other)
+    inline Array<_Ty>::Array(const Array<_Ty>& other MXL_CALLER_PARAM_IMPL)
     {
+        MXL_TRACE_CALLER(caller);
+
         if (Allocate(other.Rows(), other.Columns()))
-            std::copy(begin(other), end(other), begin(*this));
+        {
+            CopyRange(other.Data(), Data(), Size());
+            MXL_TRACE(DeepCopy, Size() * sizeof(_Ty));
+        }
     }
 
 
     template<ArrayValue _Ty>
     inline Array<_Ty>::Array(Array<_Ty>&& other)
     {
+        MXL_TRACE(Move, other.Size() * sizeof(_Ty));
+
         std::memcpy(this, &other, sizeof(Array<_Ty>));
         std::memset(&other, 0, sizeof(Array<_Ty>));
     }
@@ -37,8 +291,16 @@ namespace mxl
     template<ArrayValue _Ty>
     inline Array<_Ty>& Array<_Ty>::operator=(const Array<_Ty>& other)
     {
+        if (this == &other)
+            return *this;
+
+        Release();
+
         if (Allocate(other.Rows(), other.Columns()))
-            std::copy(begin(other), end(other), begin(*this));
+        {
+            CopyRange(other.Data(), Data(), Size());
+            MXL_TRACE(DeepCopy, Size() * sizeof(_Ty));
+        }
 
         return *this;
     }
@@ -47,6 +309,13 @@ namespace mxl
     template<ArrayValue _Ty>
     inline Array<_Ty>& Array<_Ty>::operator=(Array<_Ty>&& other)
     {
+        if (this == &other)
+            return *this;
+
+        Release();
+
+        MXL_TRACE(Move, other.Size() * sizeof(_Ty));
+
         std::memcpy(this, &other, sizeof(Array<_Ty>));
         std::memset(&other, 0, sizeof(Array<_Ty>));
 
@@ -55,7 +324,7 @@ namespace mxl
 
 
     template<ArrayValue _Ty>
-    inline Array<_Ty>::Array(const Variant& var): Array<_Ty>(static_cast<const Array<_Ty>&>(var))
+    inline Array<_Ty>::Array(const Variant& var MXL_CALLER_PARAM_IMPL): Array<_Ty>(static_cast<const Array<_Ty>&>(var) MXL_CALLER_ARG)
     {
     }
 
@@ -66,47 +335,83 @@ namespace mxl
     }
 
 
+    //
+    // Boxes every element into a Variant, or unboxes every cell into _Ty
+    // (see Detail::CellAs for what converts and how).
+    //
+    // Example:
+    // >>> mxl::Array<mxl::Bool> flags{range};     // 2 bytes per cell instead of 24
+    //
+    template<ArrayValue _Ty>
+    template<ArrayValue _Fr>
+    inline Array<_Ty>::Array(const Array<_Fr>& other MXL_CALLER_PARAM_IMPL)
+        requires (!Type::IsSame<_Ty, _Fr>) && (Type::IsSame<_Ty, Variant> || Type::IsSame<_Fr, Variant>)
+    {
+        MXL_TRACE_CALLER(caller);
+
+        if (Allocate(other.Rows(), other.Columns()))
+        {
+            // A cell that can't be converted throws out of the constructor, so
+            // the destructor won't run to free what was allocated
+            try
+            {
+                for (uint64_t i = 0; i < Size(); i++)
+                {
+                    if constexpr (Type::IsSame<_Ty, Variant>)
+                        Data()[i] = Variant{other[i]};
+                    else
+                        Data()[i] = Detail::CellAs<_Ty>(other[i]);
+                }
+            }
+            catch (...)
+            {
+                Release();
+                throw;
+            }
+
+            MXL_TRACE(DeepCopy, Size() * sizeof(_Ty));
+        }
+    }
+
+
     template<ArrayValue _Ty>
     inline Array<_Ty>::~Array()
     {
-        if (_Body.Data)
-            std::free(_Body.Data);
-        
+        Release();
+
         std::memset(this, 0, sizeof(Array<_Ty>));
     }
 
 
+    //
+    // Frees the element buffer, destroying the cells first if they are Variants
+    // (they own their strings and nested arrays). Goes by the descriptor rather
+    // than _Ty, since Variant releases every array through Array<Variant>.
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::Release()
+    {
+        if (!_Body.Data)
+            return;
+
+        if (_Body.Features & (uint16_t)ArrayFeatures::ArrayOfVariants)
+            std::destroy_n(static_cast<Variant*>(_Body.Data), Size());
+
+        MXL_TRACE(Deallocate, Size() * ElementSize());
+        Detail::Free(_Body.Data);
+
+        _Body.Data = nullptr;
+    }
+
+
     template<ArrayValue _Ty> 
     inline bool Array<_Ty>::Allocate(const uint64_t rows, const uint64_t cols)
     {
-        constexpr auto type = Type::GetID<_Ty>();
-
-        if (auto buffer = std::calloc(rows * cols, sizeof(_Ty)))
+        if (auto buffer = Detail::Calloc(rows * cols, sizeof(_Ty)))
         {
-            _Header.Type                = (uint32_t)type;
-            _Body.Dims                  = 2;
-            _Body.Features              = (uint16_t)ArrayFeatures::HasVarType;
-            _Body.ElementSize           = sizeof(_Ty);
-            _Body.Locks                 = 0;
-            _Body.Data                  = buffer;
-            _Body.Columns.ElementCount  = cols;
-            _Body.Columns.LowerBound    = 1;
-            _Body.Rows.ElementCount     = rows;
-            _Body.Rows.LowerBound       = 1;
-
-            switch (type)
-            {
-                case Type::ID::String:
-                    _Body.Features |= (uint16_t)ArrayFeatures::ArrayOfStrings;
-                    break;
+            MXL_TRACE(Allocate, rows * cols * sizeof(_Ty));
 
-                case Type::ID::Variant:
-                    _Body.Features |= (uint16_t)ArrayFeatures::ArrayOfVariants;
-                    break;
-
-                default:
-                    break;
-            }
+            Adopt(buffer, rows, cols);
 
             return true;
         }
@@ -120,6 +425,42 @@ namespace mxl
     }
 
 
+    //
+    // Takes ownership of 'buffer' (rows * cols elements, column-major) and
+    // fills in the host descriptor around it.
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::Adopt(void* buffer, const uint64_t rows, const uint64_t cols)
+    {
+        constexpr auto type = Type::GetID<_Ty>();
+
+        _Header.Type                = (uint32_t)type;
+        _Body.Dims                  = 2;
+        _Body.Features              = (uint16_t)ArrayFeatures::HasVarType;
+        _Body.ElementSize           = sizeof(_Ty);
+        _Body.Locks                 = 0;
+        _Body.Data                  = buffer;
+        _Body.Columns.ElementCount  = cols;
+        _Body.Columns.LowerBound    = 1;
+        _Body.Rows.ElementCount     = rows;
+        _Body.Rows.LowerBound       = 1;
+
+        switch (type)
+        {
+            case Type::ID::String:
+                _Body.Features |= (uint16_t)ArrayFeatures::ArrayOfStrings;
+                break;
+
+            case Type::ID::Variant:
+                _Body.Features |= (uint16_t)ArrayFeatures::ArrayOfVariants;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+
     template<ArrayValue _Ty>
     inline void Array<_Ty>::Deallocate(ArrayBody* array)
     {
@@ -127,10 +468,10 @@ namespace mxl
 
         if (ptr)
         {
-            if (ptr->_Body.Data)
-                std::free(ptr->_Body.Data);
+            ptr->Release();
 
-            std::free(ptr);
+            MXL_TRACE(Deallocate, sizeof(Array));
+            Detail::Free(ptr);
         }
     }
 
@@ -172,28 +513,349 @@ namespace mxl
         if (oldCols == cols && oldRows == rows)
             return;
 
-        auto oldPtr = Data();
+        const uint64_t keepCols = std::min(oldCols, cols);
+        const uint64_t keepRows = std::min(oldRows, rows);
+
+        // Release the Variants that don't make it into the new shape
+        if constexpr (Type::IsSame<_Ty, Variant>)
+        {
+            for (uint64_t c = 0; c < oldCols; c++)
+            {
+                const uint64_t first = c < keepCols ? keepRows : 0;
+                std::destroy_n(&operator()(first, c), oldRows - first);
+            }
+        }
+
+        const uint64_t oldBytes = oldRows * oldCols * sizeof(_Ty);
+        const uint64_t newBytes = rows * cols * sizeof(_Ty);
 
-        if (auto newPtr = static_cast<_Ty*>(calloc(rows * cols, sizeof(_Ty))))
+        if (rows == oldRows || keepCols <= 1)
         {
-            const auto newCols = std::min(oldCols, cols);
-            const auto newRows = std::min(oldRows, rows);
+            // The kept elements already sit at the front of the buffer
+            auto newPtr = static_cast<_Ty*>(Detail::Realloc(_Body.Data, oldBytes, newBytes));
+
+            if (!newPtr && newBytes)
+                MXL_THROW("Dynamic allocation failed.");
+
+            MXL_TRACE(Deallocate, oldBytes);
+            MXL_TRACE(Allocate, newBytes);
 
-            // Copy each column from old buffer to new
-            for (uint64_t c = 0; c < newCols; c++)
+            const uint64_t kept = (rows == oldRows) ? rows * keepCols : keepRows * keepCols;
+            std::memset(newPtr + kept, 0, newBytes - kept * sizeof(_Ty));
+
+            _Body.Data = newPtr;
+        }
+        else if (auto newPtr = static_cast<_Ty*>(Detail::Calloc(rows * cols, sizeof(_Ty))))
+        {
+            MXL_TRACE(Allocate, newBytes);
+
+            // Move each kept column; elements are relocated bitwise, so Variants
+            // change owner without being copied
+            for (uint64_t c = 0; c < keepCols; c++)
+                std::memcpy(&newPtr[c * rows], &operator()(0, c), keepRows * sizeof(_Ty));
+
+            MXL_TRACE(Deallocate, oldBytes);
+            Detail::Free(_Body.Data);
+
+            _Body.Data = newPtr;
+        }
+        else
+        {
+            MXL_THROW("Dynamic allocation failed.");
+        }
+
+        _Body.Columns.ElementCount = cols;
+        _Body.Rows.ElementCount = rows;
+    }
+
+
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::ToRowMajor(_Ty* out) const requires (!Type::IsSame<_Ty, Variant>)
+    {
+        Detail::Transpose(Data(), Rows(), out, Columns(), Rows(), Columns());
+    }
+
+
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::FromRowMajor(const _Ty* in) requires (!Type::IsSame<_Ty, Variant>)
+    {
+        // A row-major rows x cols buffer is a column-major cols x rows one
+        Detail::Transpose(in, Columns(), Data(), Rows(), Columns(), Rows());
+    }
+
+
+    template<ArrayValue _Ty>
+    inline Array<_Ty> Array<_Ty>::Transposed() const
+    {
+        Array<_Ty> result(Columns(), Rows());
+
+        // The result's columns are this array's rows, i.e. its row-major layout
+        Detail::Transpose(Data(), Rows(), result.Data(), Columns(), Rows(), Columns());
+
+        return result;
+    }
+
+
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::Transpose()
+    {
+        if (Rows() != Columns())
+            MXL_THROW("In-place transpose needs a square array; use Transposed() instead.");
+
+        Detail::TransposeSquare(Data(), Rows());
+    }
+
+
+    //
+    // Counts the type tags of every cell in a single pass.
+    //
+    template<ArrayValue _Ty>
+    inline ArrayCensus Array<_Ty>::Census() const requires Type::IsSame<_Ty, Variant>
+    {
+        ArrayCensus census{};
+        CensusRange(Data(), Size(), census);
+
+        return census;
+    }
+
+
+    //
+    // Writes every cell as a double into 'out', which must hold Size() elements.
+    // Output follows the array's column-major order.
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::Unbox(double* out, UnboxPolicy policy) const requires Type::IsSame<_Ty, Variant>
+    {
+        UnboxRange(Data(), Size(), out, policy);
+    }
+
+
+    //
+    // Writes a single column as doubles into 'out', which must hold Rows() elements.
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::UnboxColumn(uint64_t col, double* out, UnboxPolicy policy) const requires Type::IsSame<_Ty, Variant>
+    {
+        if (col >= Columns())
+            MXL_THROW("Column index out of range");
+
+        UnboxRange(Data() + col * Rows(), Rows(), out, policy);
+    }
+
+
+    //
+    // Returns a dense mxl::Array<double> with the same shape.
+    //
+    template<ArrayValue _Ty>
+    inline Array<double> Array<_Ty>::Unbox(UnboxPolicy policy) const requires Type::IsSame<_Ty, Variant>
+    {
+        Array<double> result(Rows(), Columns());
+
+        if (Size() && !result.Data())
+            MXL_THROW("Dynamic allocation failed.");
+
+        UnboxRange(Data(), Size(), result.Data(), policy);
+
+        return result;
+    }
+
+
+    //
+    // Overwrites every cell with a Double Variant taken from 'in' (Size() elements).
+    // Strings and Arrays previously held by the cells are freed.
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::Box(const double* in) requires Type::IsSame<_Ty, Variant>
+    {
+        BoxRange(Data(), Size(), in);
+    }
+
+
+    //
+    // Overwrites a single column with Double Variants taken from 'in' (Rows() elements).
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::BoxColumn(uint64_t col, const double* in) requires Type::IsSame<_Ty, Variant>
+    {
+        if (col >= Columns())
+            MXL_THROW("Column index out of range");
+
+        BoxRange(Data() + col * Rows(), Rows(), in);
+    }
+
+
+    //
+    // Deep-copies 'count' elements into freshly allocated (zeroed) storage.
+    //
+    // Numbers are plain bytes, so typed Arrays are a single memcpy. For
+    // Variants, each run of cells that own nothing (numbers, Empty, errors,
+    // ...) is copied with one memcpy, strings are duplicated from their stored
+    // length with one allocation each (no terminator scan, no temporaries) and
+    // only nested arrays go through the Variant copy constructor.
+    //
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::CopyRange(const _Ty* from, _Ty* to, const uint64_t count)
+    {
+        if (!count)
+            return;
+
+        if constexpr (Type::IsSame<_Ty, Variant>)
+        {
+            uint64_t run = 0;
+
+            for (uint64_t i = 0; i < count; i++)
             {
-                auto oldColBegin    = &operator()(0, c);
-                auto oldColEnd      = &operator()(newRows, c);
-                auto newColBegin    = &newPtr[c * rows];
+                const auto& cell = from[i];
+
+                if (!cell.IsString() && !cell.IsArray())
+                    continue;
+
+                std::memcpy(to + run, from + run, (i - run) * sizeof(Variant));
+                run = i + 1;
 
-                std::copy(oldColBegin, oldColEnd, newColBegin);
+                if (cell.IsString())
+                    new (to + i) Variant{String{static_cast<const String&>(cell)}};
+                else
+                    new (to + i) Variant{cell};
             }
 
-            _Body.Data = newPtr;
-            _Body.Columns.ElementCount = cols;
-            _Body.Rows.ElementCount = rows;
+            std::memcpy(to + run, from + run, (count - run) * sizeof(Variant));
+        }
+        else
+        {
+            std::memcpy(to, from, count * sizeof(_Ty));
+        }
+    }
+
+
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::CensusRange(const Variant* cells, const uint64_t count, ArrayCensus& census)
+    {
+        // Buckets: 0 = Empty, 1 = Double, 2 = Numeric, 3 = Bool, 4 = Date, 5 = String,
+        // 6 = Error, 7 = Other. Scalar type IDs all fit in 5 bits; anything above
+        // (e.g. arrays) is Other.
+        constexpr auto buckets = []
+        {
+            std::array<uint8_t, 32> table{};
+            table.fill(7);
+
+            table[(uint16_t)Type::ID::Empty]    = 0;
+            table[(uint16_t)Type::ID::Double]   = 1;
+            table[(uint16_t)Type::ID::Int16]    = 2;
+            table[(uint16_t)Type::ID::Int32]    = 2;
+            table[(uint16_t)Type::ID::Int64]    = 2;
+            table[(uint16_t)Type::ID::Float]    = 2;
+            table[(uint16_t)Type::ID::Byte]     = 2;
+            table[(uint16_t)Type::ID::Bool]     = 3;
+            table[(uint16_t)Type::ID::Date]     = 4;
+            table[(uint16_t)Type::ID::String]   = 5;
+            table[(uint16_t)Type::ID::Error]    = 6;
+
+            return table;
+        }();
+
+        uint64_t counts[8] = {};
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+            const auto id = (uint16_t)cells[i]._Type;
+            counts[id < buckets.size() ? buckets[id] : 7]++;
+        }
+
+        census.Empty    += counts[0];
+        census.Double   += counts[1];
+        census.Numeric  += counts[2];
+        census.Bool     += counts[3];
+        census.Date     += counts[4];
+        census.String   += counts[5];
+        census.Error    += counts[6];
+        census.Other    += counts[7];
+    }
+
+
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::UnboxRange(const Variant* cells, const uint64_t count, double* out, UnboxPolicy policy)
+    {
+        const double fallback = policy == UnboxPolicy::NaN ? std::numeric_limits<double>::quiet_NaN() : 0.0;
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+            const auto& cell = cells[i];
+
+            switch (cell._Type)
+            {
+                case Type::ID::Double:  out[i] = cell._Value.Double;                 break;
+                case Type::ID::Int16:   out[i] = (double)cell._Value.Int16;          break;
+                case Type::ID::Int32:   out[i] = (double)cell._Value.Int32;          break;
+                case Type::ID::Int64:   out[i] = (double)cell._Value.Int64;          break;
+                case Type::ID::Float:   out[i] = (double)cell._Value.Float;          break;
+                case Type::ID::Byte:    out[i] = (double)cell._Value.Byte;           break;
+                case Type::ID::Bool:    out[i] = cell._Value.Int16 ? -1.0 : 0.0;     break;
+                case Type::ID::Date:    out[i] = cell._Value.Double;                 break;
+
+                default:
+                {
+                    if (policy == UnboxPolicy::Throw)
+                        MXL_THROW("Invalid attempt to unbox non-numeric Variant");
+
+                    out[i] = fallback;
+                }
+            }
+        }
+    }
+
+
+    template<ArrayValue _Ty>
+    inline void Array<_Ty>::BoxRange(Variant* cells, const uint64_t count, const double* in)
+    {
+        static_assert(sizeof(Variant) == 24, "Variant must match the host VARIANT layout");
+
+        // Release whatever the cells own before blindly overwriting them
+        for (uint64_t i = 0; i < count; i++)
+        {
+            if (cells[i].IsString() || cells[i].IsArray())
+                cells[i].Deallocate();
+        }
+
+        // A Double Variant is three 8-byte words: [tag, value, 0]. Two of them
+        // fill exactly three 16-byte vectors, so cells are written in pairs.
+        auto        bytes   = reinterpret_cast<std::byte*>(cells);
+        uint64_t    i       = 0;
+
+#if defined(__SSE2__)
+        const __m128i tag   = _mm_cvtsi32_si128((int)Type::ID::Double);
+        const __m128i mid   = _mm_slli_si128(tag, 8);
+        const __m128i zero  = _mm_setzero_si128();
+
+        for (; i + 2 <= count; i += 2, bytes += 2 * sizeof(Variant))
+        {
+            const __m128i values = _mm_castpd_si128(_mm_loadu_pd(in + i));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes),      _mm_unpacklo_epi64(tag, values));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + 16), mid);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + 32), _mm_unpackhi_epi64(values, zero));
+        }
+#elif defined(__ARM_NEON)
+        const uint64x1_t tag   = vcreate_u64((uint64_t)Type::ID::Double);
+        const uint64x1_t zero  = vcreate_u64(0);
+        const uint64x2_t mid   = vcombine_u64(zero, tag);
+
+        for (; i + 2 <= count; i += 2, bytes += 2 * sizeof(Variant))
+        {
+            const uint64x2_t values = vld1q_u64(reinterpret_cast<const uint64_t*>(in + i));
+
+            vst1q_u64(reinterpret_cast<uint64_t*>(bytes),      vcombine_u64(tag, vget_low_u64(values)));
+            vst1q_u64(reinterpret_cast<uint64_t*>(bytes + 16), mid);
+            vst1q_u64(reinterpret_cast<uint64_t*>(bytes + 32), vcombine_u64(vget_high_u64(values), zero));
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            std::memset(&cells[i], 0, sizeof(Variant));
 
-            std::free(oldPtr);
+            cells[i]._Type          = Type::ID::Double;
+            cells[i]._Value.Double  = in[i];
         }
     }
 
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Borrowed.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    template <ArrayValue _Ty>
+    inline BorrowedArray<_Ty>::BorrowedArray(const Array<_Ty>& source)
+        : _Source{&source}, _Blocks((source.Size() + BlockSize - 1) >> BlockShift, nullptr), _Copied{0}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BorrowedArray<_Ty>::BorrowedArray(const Variant& source): BorrowedArray(static_cast<const Array<_Ty>&>(source))
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BorrowedArray<_Ty>::~BorrowedArray()
+    {
+        Release();
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BorrowedArray<_Ty>::BorrowedArray(BorrowedArray&& other)
+        : _Source{other._Source}, _Blocks{std::move(other._Blocks)}, _Copied{other._Copied}
+    {
+        other._Blocks.clear();
+        other._Copied = 0;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BorrowedArray<_Ty>& BorrowedArray<_Ty>::operator=(BorrowedArray&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        Release();
+
+        _Source = other._Source;
+        _Blocks = std::move(other._Blocks);
+        _Copied = other._Copied;
+
+        other._Blocks.clear();
+        other._Copied = 0;
+
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline bool BorrowedArray<_Ty>::IsCopied(const uint64_t row, const uint64_t col) const
+    {
+        return _Blocks[(row + col * Rows()) >> BlockShift] != nullptr;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline const _Ty& BorrowedArray<_Ty>::operator[](const uint64_t index) const
+    {
+        if (auto block = _Blocks[index >> BlockShift])
+            return block[index & (BlockSize - 1)];
+
+        return _Source->Data()[index];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline const _Ty& BorrowedArray<_Ty>::operator()(const uint64_t row, const uint64_t col) const
+    {
+        return operator[](row + col * Rows());
+    }
+
+
+    template <ArrayValue _Ty>
+    inline _Ty& BorrowedArray<_Ty>::Write(const uint64_t index MXL_CALLER_PARAM_IMPL)
+    {
+        MXL_TRACE_CALLER(caller);
+
+        auto block = _Blocks[index >> BlockShift];
+
+        if (!block)
+            block = CopyBlock(index >> BlockShift);
+
+        return block[index & (BlockSize - 1)];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline _Ty& BorrowedArray<_Ty>::Write(const uint64_t row, const uint64_t col MXL_CALLER_PARAM_IMPL)
+    {
+        return Write(row + col * Rows() MXL_CALLER_ARG);
+    }
+
+
+    //
+    // Copied blocks are taken from private memory and the rest from the
+    // borrowed data, each with the same bulk copy as Array's copy constructor.
+    //
+    template <ArrayValue _Ty>
+    inline Array<_Ty> BorrowedArray<_Ty>::Materialize(MXL_CALLER_PARAM_IMPL_ONLY) const
+    {
+        MXL_TRACE_CALLER(caller);
+
+        Array<_Ty> result(Rows(), Columns());
+
+        if (result.Size() != Size())
+            MXL_THROW("Dynamic allocation failed.");
+
+        for (uint64_t block = 0; block < _Blocks.size(); block++)
+            Array<_Ty>::CopyRange(BlockData(block), result.Data() + (block << BlockShift), BlockLength(block));
+
+        MXL_TRACE(DeepCopy, Size() * sizeof(_Ty));
+
+        return result;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline const _Ty* BorrowedArray<_Ty>::BlockData(const uint64_t block) const
+    {
+        return _Blocks[block] ? _Blocks[block] : _Source->Data() + (block << BlockShift);
+    }
+
+
+    template <ArrayValue _Ty>
+    inline uint64_t BorrowedArray<_Ty>::BlockLength(const uint64_t block) const
+    {
+        return std::min(BlockSize, Size() - (block << BlockShift));
+    }
+
+
+    template <ArrayValue _Ty>
+    inline _Ty* BorrowedArray<_Ty>::CopyBlock(const uint64_t block)
+    {
+        const uint64_t length = BlockLength(block);
+
+        auto data = static_cast<_Ty*>(Detail::Calloc(length, sizeof(_Ty)));
+
+        if (!data)
+            MXL_THROW("Dynamic allocation failed.");
+
+        MXL_TRACE(Allocate, length * sizeof(_Ty));
+        MXL_TRACE(DeepCopy, length * sizeof(_Ty));
+
+        Array<_Ty>::CopyRange(_Source->Data() + (block << BlockShift), data, length);
+
+        _Blocks[block] = data;
+        _Copied++;
+
+        return data;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline void BorrowedArray<_Ty>::Release()
+    {
+        for (uint64_t block = 0; block < _Blocks.size(); block++)
+        {
+            auto data = _Blocks[block];
+
+            if (!data)
+                continue;
+
+            if constexpr (Type::IsSame<_Ty, Variant>)
+                std::destroy_n(data, BlockLength(block));
+
+            MXL_TRACE(Deallocate, BlockLength(block) * sizeof(_Ty));
+            Detail::Free(data);
+        }
+
+        _Blocks.clear();
+        _Copied = 0;
+    }
+}
\ No newline at end of file
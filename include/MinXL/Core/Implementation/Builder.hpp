@@ -0,0 +1,217 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Builder.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    template <ArrayValue _Ty>
+    inline ArrayBuilder<_Ty>::ArrayBuilder(const uint64_t cols, const uint64_t capacity)
+        : _Data{nullptr}, _Columns{cols}, _Capacity{0}, _Rows{0}, _Column{0}
+    {
+        if (cols == 0)
+            MXL_THROW("An array builder needs at least one column.");
+
+        if (capacity)
+            Grow(capacity);
+    }
+
+
+    template <ArrayValue _Ty>
+    inline ArrayBuilder<_Ty>::~ArrayBuilder()
+    {
+        Release();
+    }
+
+
+    template <ArrayValue _Ty>
+    inline ArrayBuilder<_Ty>::ArrayBuilder(ArrayBuilder&& other)
+        : _Data{other._Data}, _Columns{other._Columns}, _Capacity{other._Capacity}, _Rows{other._Rows}, _Column{other._Column}
+    {
+        other._Data = nullptr;
+        other._Capacity = other._Rows = other._Column = 0;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline ArrayBuilder<_Ty>& ArrayBuilder<_Ty>::operator=(ArrayBuilder&& other)
+    {
+        if (this == &other)
+            return *this;
+
+        Release();
+
+        _Data       = other._Data;
+        _Columns    = other._Columns;
+        _Capacity   = other._Capacity;
+        _Rows       = other._Rows;
+        _Column     = other._Column;
+
+        other._Data = nullptr;
+        other._Capacity = other._Rows = other._Column = 0;
+
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline void ArrayBuilder<_Ty>::Reserve(const uint64_t rows)
+    {
+        if (rows > _Capacity)
+            Grow(std::max(rows, _Capacity * 2));
+    }
+
+
+    template <ArrayValue _Ty>
+    template <typename _Tv>
+    inline void ArrayBuilder<_Ty>::Append(_Tv&& value)
+    {
+        if (_Rows == _Capacity)
+            Grow(std::max(MinCapacity, _Capacity * 2));
+
+        // The slot is zeroed memory (an Empty Variant), so there is nothing to destroy
+        new (&_Data[_Rows + _Column * _Capacity]) _Ty(std::forward<_Tv>(value));
+
+        if (++_Column == _Columns)
+        {
+            _Column = 0;
+            _Rows++;
+        }
+    }
+
+
+    template <ArrayValue _Ty>
+    template <typename... _Tv>
+    inline void ArrayBuilder<_Ty>::AppendRow(_Tv&&... values)
+    {
+        if (sizeof...(_Tv) != _Columns)
+            MXL_THROW("Row length doesn't match the number of columns.");
+
+        if (_Column != 0)
+            MXL_THROW("Can't append a row after a partial row.");
+
+        if (_Rows == _Capacity)
+            Grow(std::max(MinCapacity, _Capacity * 2));
+
+        auto cell = &_Data[_Rows];
+
+        ((new (cell) _Ty(std::forward<_Tv>(values)), cell += _Capacity), ...);
+
+        _Rows++;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline _Ty& ArrayBuilder<_Ty>::operator()(const uint64_t row, const uint64_t col)
+    {
+        return _Data[row + col * _Capacity];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline const _Ty& ArrayBuilder<_Ty>::operator()(const uint64_t row, const uint64_t col) const
+    {
+        return _Data[row + col * _Capacity];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline Array<_Ty> ArrayBuilder<_Ty>::Finish()
+    {
+        const uint64_t rows = Rows();
+
+        if (!_Data)
+            return Array<_Ty>(0, _Columns);
+
+        // Close the gaps between columns; each one moves down, never onto a
+        // column that is still to be moved
+        for (uint64_t c = 1; c < _Columns; c++)
+            std::memmove(&_Data[c * rows], &_Data[c * _Capacity], rows * sizeof(_Ty));
+
+        const uint64_t capacityBytes = _Capacity * _Columns * sizeof(_Ty);
+        const uint64_t bytes = rows * _Columns * sizeof(_Ty);
+
+        void* buffer = _Data;
+
+        // Hand the unused capacity back; arena memory is released with its arena
+        // anyway, and moving it would be exactly the copy this class avoids
+        if (bytes < capacityBytes && !Detail::IsArenaMemory(buffer))
+        {
+            if (auto shrunk = Detail::Realloc(buffer, capacityBytes, bytes))
+                buffer = shrunk;
+        }
+
+        MXL_TRACE(Deallocate, capacityBytes);
+        MXL_TRACE(Allocate, bytes);
+
+        Array<_Ty> result;
+        result.Adopt(buffer, rows, _Columns);
+
+        _Data = nullptr;
+        _Capacity = _Rows = _Column = 0;
+
+        return result;
+    }
+
+
+    //
+    // Grows every column to 'capacity' rows. The buffer is extended with
+    // realloc, then the columns are spread out from the last one down (each
+    // moves up, so never onto one still to be moved) and the new room in each
+    // column is zeroed.
+    //
+    template <ArrayValue _Ty>
+    inline void ArrayBuilder<_Ty>::Grow(const uint64_t capacity)
+    {
+        const uint64_t used = Rows();
+        const uint64_t oldBytes = _Capacity * _Columns * sizeof(_Ty);
+        const uint64_t newBytes = capacity * _Columns * sizeof(_Ty);
+
+        auto data = static_cast<_Ty*>(Detail::Realloc(_Data, oldBytes, newBytes));
+
+        if (!data)
+            MXL_THROW("Dynamic allocation failed.");
+
+        if (_Data)
+            MXL_TRACE(Deallocate, oldBytes);
+
+        MXL_TRACE(Allocate, newBytes);
+
+        for (uint64_t c = _Columns; c-- > 0;)
+        {
+            if (c && used)
+                std::memmove(&data[c * capacity], &data[c * _Capacity], used * sizeof(_Ty));
+
+            std::memset(&data[c * capacity + used], 0, (capacity - used) * sizeof(_Ty));
+        }
+
+        _Data = data;
+        _Capacity = capacity;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline void ArrayBuilder<_Ty>::Release()
+    {
+        if (!_Data)
+            return;
+
+        if constexpr (Type::IsSame<_Ty, Variant>)
+        {
+            for (uint64_t c = 0; c < _Columns; c++)
+                std::destroy_n(&_Data[c * _Capacity], Rows());
+        }
+
+        MXL_TRACE(Deallocate, _Capacity * _Columns * sizeof(_Ty));
+        Detail::Free(_Data);
+
+        _Data = nullptr;
+        _Capacity = _Rows = _Column = 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,353 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Cache.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        //
+        // Hashes 'size' bytes with four independent HashStep lanes, so that the
+        // multiply chains of consecutive words overlap instead of serializing.
+        //
+        inline uint64_t HashBytes(const void* data, const uint64_t size, const uint64_t seed)
+        {
+            auto bytes = static_cast<const std::byte*>(data);
+
+            uint64_t lanes[4] = {
+                seed,
+                seed + 0x9E3779B97F4A7C15,
+                seed + 0x3C6EF372FE94F82A,
+                seed + 0xDAA66D2C7DDF743F
+            };
+
+            uint64_t i = 0;
+
+            for (; i + 32 <= size; i += 32)
+            {
+                for (uint64_t k = 0; k < 4; k++)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, bytes + i + 8 * k, sizeof(word));
+                    lanes[k] = HashStep(lanes[k], word);
+                }
+            }
+
+            uint64_t hash = HashStep(HashStep(HashStep(lanes[0], lanes[1]), lanes[2]), lanes[3]);
+
+            for (; i + 8 <= size; i += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                hash = HashStep(hash, word);
+            }
+
+            if (i < size)
+            {
+                uint64_t word = 0;
+                std::memcpy(&word, bytes + i, size - i);
+                hash = HashStep(hash, word);
+            }
+
+            return HashFinal(hash ^ size);
+        }
+
+
+        //
+        // Bytes of memory owned by a Variant, including everything it points to.
+        //
+        inline uint64_t Footprint(const Variant& value)
+        {
+            uint64_t bytes = sizeof(Variant);
+
+            if (value.IsString())
+            {
+                bytes += sizeof(StringHeader) + (static_cast<const String&>(value).Size() + 1) * sizeof(char16_t);
+            }
+            else if (value.IsArray())
+            {
+                auto numeric = [](const auto& array)
+                {
+                    return sizeof(array) + array.Size() * array.ElementSize();
+                };
+
+                switch (value.ArrayTypeID())
+                {
+                    case Type::ID::Int16:   bytes += numeric(static_cast<const Array<int16_t>&>(value));    break;
+                    case Type::ID::Int32:   bytes += numeric(static_cast<const Array<int32_t>&>(value));    break;
+                    case Type::ID::Int64:   bytes += numeric(static_cast<const Array<int64_t>&>(value));    break;
+                    case Type::ID::Float:   bytes += numeric(static_cast<const Array<float>&>(value));      break;
+                    case Type::ID::Double:  bytes += numeric(static_cast<const Array<double>&>(value));     break;
+                    case Type::ID::Bool:    bytes += numeric(static_cast<const Array<Bool>&>(value));       break;
+                    case Type::ID::Byte:    bytes += numeric(static_cast<const Array<Byte>&>(value));       break;
+                    case Type::ID::Date:    bytes += numeric(static_cast<const Array<Date>&>(value));       break;
+
+                    case Type::ID::Variant:
+                    {
+                        auto& array = static_cast<const Array<Variant>&>(value);
+                        bytes += sizeof(array);
+
+                        for (uint64_t i = 0; i < array.Size(); i++)
+                            bytes += Footprint(array[i]);
+
+                        break;
+                    }
+
+                    default: ;
+                }
+            }
+
+            return bytes;
+        }
+    }
+
+
+    inline uint64_t Fingerprint(const Variant& value, const uint64_t seed)
+    {
+        uint64_t hash = Detail::HashStep(seed, (uint64_t)value._Type);
+
+        switch (value._Type)
+        {
+            case Type::ID::Empty:   break;
+            case Type::ID::Byte:    hash = Detail::HashStep(hash, value._Value.Byte);                           break;
+            case Type::ID::Bool:
+            case Type::ID::Int16:   hash = Detail::HashStep(hash, (uint64_t)value._Value.Int16);                break;
+            case Type::ID::Error:
+            case Type::ID::Int32:   hash = Detail::HashStep(hash, (uint64_t)value._Value.Int32);                break;
+            case Type::ID::Int64:   hash = Detail::HashStep(hash, (uint64_t)value._Value.Int64);                break;
+            case Type::ID::Float:   hash = Detail::HashStep(hash, std::bit_cast<uint32_t>(value._Value.Float));  break;
+            case Type::ID::Date:
+            case Type::ID::Double:  hash = Detail::HashStep(hash, std::bit_cast<uint64_t>(value._Value.Double)); break;
+            case Type::ID::String:  return Fingerprint(static_cast<const String&>(value), hash);
+
+            default:
+            {
+                // Anything not listed (Currency, Range references, host String
+                // arrays, ...) would only hash its type tag, so refuse it rather
+                // than hand out a fingerprint that ignores its contents
+                if (value.IsArray())
+                {
+                    switch (value.ArrayTypeID())
+                    {
+                        case Type::ID::Int16:   return Fingerprint(static_cast<const Array<int16_t>&>(value), hash);
+                        case Type::ID::Int32:   return Fingerprint(static_cast<const Array<int32_t>&>(value), hash);
+                        case Type::ID::Int64:   return Fingerprint(static_cast<const Array<int64_t>&>(value), hash);
+                        case Type::ID::Float:   return Fingerprint(static_cast<const Array<float>&>(value), hash);
+                        case Type::ID::Double:  return Fingerprint(static_cast<const Array<double>&>(value), hash);
+                        case Type::ID::Bool:    return Fingerprint(static_cast<const Array<Bool>&>(value), hash);
+                        case Type::ID::Byte:    return Fingerprint(static_cast<const Array<Byte>&>(value), hash);
+                        case Type::ID::Date:    return Fingerprint(static_cast<const Array<Date>&>(value), hash);
+                        case Type::ID::Variant: return Fingerprint(static_cast<const Array<Variant>&>(value), hash);
+                        default: ;
+                    }
+                }
+
+                MXL_THROW("Invalid attempt to fingerprint a Variant of unsupported type");
+            }
+        }
+
+        return Detail::HashFinal(hash);
+    }
+
+
+    inline uint64_t Fingerprint(const String& value, const uint64_t seed)
+    {
+        return Detail::HashBytes(value.Buffer(), value.Size() * sizeof(char16_t), Detail::HashStep(seed, (uint64_t)Type::ID::String));
+    }
+
+
+    template <ArrayValue _Ty>
+    inline uint64_t Fingerprint(const Array<_Ty>& value, const uint64_t seed)
+    {
+        uint64_t hash = Detail::HashStep(seed, (uint64_t)Type::GetID<_Ty>());
+        hash = Detail::HashStep(hash, value.Rows());
+        hash = Detail::HashStep(hash, value.Columns());
+
+        if constexpr (Type::IsSame<_Ty, Variant>)
+        {
+            for (uint64_t i = 0; i < value.Size(); i++)
+                hash = Fingerprint(value[i], hash);
+
+            return Detail::HashFinal(hash);
+        }
+        else
+        {
+            return Detail::HashBytes(value.Data(), value.Size() * sizeof(_Ty), hash);
+        }
+    }
+
+
+    template <typename... _Args>
+    inline std::vector<uint64_t> Fingerprints(const _Args&... args)
+    {
+        return std::vector<uint64_t>{Fingerprint(args)...};
+    }
+
+
+    inline size_t ResultCache::KeyHash::operator()(const Key& key) const
+    {
+        uint64_t hash = Detail::HashStep(0, key.Function);
+
+        for (auto fingerprint : key.Fingerprints)
+            hash = Detail::HashStep(hash, fingerprint);
+
+        return Detail::HashFinal(hash);
+    }
+
+
+    inline ResultCache::ResultCache(const uint64_t capacity): _Capacity{capacity}, _Bytes{0}, _Statistics{}
+    {
+    }
+
+
+    inline std::optional<Variant> ResultCache::Find(const uint64_t function, const std::vector<uint64_t>& fingerprints)
+    {
+        std::shared_ptr<const Variant> value;
+
+        {
+            std::lock_guard lock{_Lock};
+
+            auto it = _Index.find(Key{function, fingerprints});
+
+            if (it == _Index.end())
+            {
+                _Statistics.Misses++;
+                return std::nullopt;
+            }
+
+            _Entries.splice(_Entries.begin(), _Entries, it->second);
+            _Statistics.Hits++;
+
+            value = it->second->Value;
+        }
+
+        // Copy outside the lock; the entry stays alive through 'value' even if evicted meanwhile
+        return Variant{*value};
+    }
+
+
+    inline void ResultCache::Insert(const uint64_t function, const std::vector<uint64_t>& fingerprints, const Variant& result)
+    {
+        std::shared_ptr<const Variant> copy;
+
+        {
+            // The cache outlives any ArenaScope of the calling UDF
+            Arena::Bypass bypass;
+            copy = std::make_shared<const Variant>(result);
+        }
+
+        const uint64_t bytes = Detail::Footprint(*copy) + sizeof(Entry) + fingerprints.size() * sizeof(uint64_t);
+
+        std::lock_guard lock{_Lock};
+
+        if (bytes > _Capacity)
+            return;
+
+        Key key{function, fingerprints};
+
+        if (auto it = _Index.find(key); it != _Index.end())
+        {
+            _Bytes -= it->second->Bytes;
+            _Entries.erase(it->second);
+            _Index.erase(it);
+        }
+
+        Evict(_Capacity - bytes);
+
+        _Entries.push_front(Entry{key, std::move(copy), bytes});
+        _Index.emplace(std::move(key), _Entries.begin());
+        _Bytes += bytes;
+    }
+
+
+    template <typename _Fn>
+    inline Variant ResultCache::GetOrCompute(const uint64_t function, const std::vector<uint64_t>& fingerprints, _Fn&& compute)
+    {
+        if (auto hit = Find(function, fingerprints))
+            return std::move(*hit);
+
+        Variant result = compute();
+        Insert(function, fingerprints, result);
+
+        return result;
+    }
+
+
+    inline void ResultCache::Clear()
+    {
+        std::lock_guard lock{_Lock};
+
+        _Index.clear();
+        _Entries.clear();
+        _Bytes = 0;
+    }
+
+
+    inline void ResultCache::SetCapacity(const uint64_t capacity)
+    {
+        std::lock_guard lock{_Lock};
+
+        _Capacity = capacity;
+        Evict(capacity);
+    }
+
+
+    inline uint64_t ResultCache::Size() const
+    {
+        std::lock_guard lock{_Lock};
+        return _Entries.size();
+    }
+
+
+    inline uint64_t ResultCache::BytesUsed() const
+    {
+        std::lock_guard lock{_Lock};
+        return _Bytes;
+    }
+
+
+    inline uint64_t ResultCache::Capacity() const
+    {
+        std::lock_guard lock{_Lock};
+        return _Capacity;
+    }
+
+
+    inline ResultCache::Statistics ResultCache::Stats() const
+    {
+        std::lock_guard lock{_Lock};
+        return _Statistics;
+    }
+
+
+    inline ResultCache& ResultCache::Global()
+    {
+        static ResultCache cache;
+        return cache;
+    }
+
+
+    //
+    // Drops least recently used entries until at most 'capacity' bytes remain.
+    // Must be called with the lock held.
+    //
+    inline void ResultCache::Evict(const uint64_t capacity)
+    {
+        while (_Bytes > capacity && !_Entries.empty())
+        {
+            auto& last = _Entries.back();
+
+            _Bytes -= last.Bytes;
+            _Index.erase(last.Id);
+            _Entries.pop_back();
+            _Statistics.Evictions++;
+        }
+    }
+}
\ No newline at end of file
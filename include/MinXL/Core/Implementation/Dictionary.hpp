@@ -0,0 +1,144 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Dictionary.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+#include "MinXL/Core/Interface/View.hpp"
+
+
+namespace mxl
+{
+    inline uint32_t StringPool::Intern(const String& str)
+    {
+        return Intern(std::u16string_view{str.Buffer() ? str.Buffer() : u"", str.Size()});
+    }
+
+
+    //
+    // Returns the code of 'str', adding it to the pool if it is new.
+    //
+    inline uint32_t StringPool::Intern(std::u16string_view str)
+    {
+        if (auto it = _Codes.find(str); it != _Codes.end())
+            return it->second;
+
+        if (_Strings.size() >= NotFound)
+            MXL_THROW("StringPool is full");
+
+        const auto code = (uint32_t)_Strings.size();
+
+        // Keep the pool's copy off any active arena; the pool may outlive it
+        {
+            Arena::Bypass bypass;
+            _Strings.emplace_back(str.data(), str.size());
+        }
+
+        // Key the map with a view into our own copy (deque never relocates it)
+        const auto& stored = _Strings.back();
+        _Codes.emplace(std::u16string_view{stored.Buffer(), stored.Size()}, code);
+
+        return code;
+    }
+
+
+    inline uint32_t StringPool::Find(const String& str) const
+    {
+        return Find(std::u16string_view{str.Buffer() ? str.Buffer() : u"", str.Size()});
+    }
+
+
+    inline uint32_t StringPool::Find(std::u16string_view str) const
+    {
+        auto it = _Codes.find(str);
+        return it != _Codes.end() ? it->second : NotFound;
+    }
+
+
+    inline const String& StringPool::operator[](const uint32_t code) const
+    {
+        return _Strings[code];
+    }
+
+
+    inline void StringPool::Reserve(const uint64_t count)
+    {
+        _Codes.reserve(count);
+    }
+
+
+    inline DictionaryColumn::DictionaryColumn(StringPool& pool, StridedView<const Variant> column)
+        : _Pool{&pool}, _Codes(column.Size(), Missing)
+    {
+        // Consecutive repeats are common in sorted or grouped sheets; skip the hash for them
+        const char16_t*     lastBuffer  = nullptr;
+        uint32_t            lastCode    = Missing;
+
+        for (uint64_t row = 0; row < column.Size(); row++)
+        {
+            auto& cell = column[row];
+
+            if (!cell.IsString())
+                continue;
+
+            auto& str = static_cast<const String&>(cell);
+
+            if (str.Buffer() != lastBuffer)
+            {
+                lastBuffer  = str.Buffer();
+                lastCode    = pool.Intern(str);
+            }
+
+            _Codes[row] = lastCode;
+        }
+    }
+
+
+    inline DictionaryColumn::DictionaryColumn(StringPool& pool, const Array<Variant>& array, const uint64_t col)
+        : DictionaryColumn(pool, array.ColumnView(col))
+    {
+    }
+
+
+    inline const String* DictionaryColumn::Decode(const uint64_t row) const
+    {
+        const auto code = _Codes[row];
+        return code != Missing ? &(*_Pool)[code] : nullptr;
+    }
+
+
+    inline std::vector<uint64_t> DictionaryColumn::Match(const String& str) const
+    {
+        std::vector<uint64_t> rows;
+
+        const auto code = _Pool->Find(str);
+
+        if (code == StringPool::NotFound)
+            return rows;
+
+        for (uint64_t row = 0; row < _Codes.size(); row++)
+        {
+            if (_Codes[row] == code)
+                rows.push_back(row);
+        }
+
+        return rows;
+    }
+
+
+    inline std::vector<uint64_t> DictionaryColumn::Histogram() const
+    {
+        std::vector<uint64_t> counts(_Pool->Size(), 0);
+
+        for (auto code : _Codes)
+        {
+            if (code != Missing)
+                counts[code]++;
+        }
+
+        return counts;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Expression.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        inline const Variant& AsVariant(const Variant& value)
+        {
+            return value;
+        }
+
+
+        template <Numeric _Ty>
+        inline Variant AsVariant(const _Ty value)
+        {
+            return Variant{value};
+        }
+
+
+        template <ArrayValue _Ty>
+        inline ArrayLeaf<_Ty>::ArrayLeaf(const Array<_Ty>& array)
+            : _Data{array.Data()}, _Rows{array.Rows()}, _Columns{array.Columns()}
+        {
+        }
+
+
+        template <Numeric _Ty>
+        inline ScalarLeaf<_Ty>::ScalarLeaf(_Ty value): _Value{value}
+        {
+        }
+
+
+        template <typename _Re, typename _T1, typename _T2>
+        inline _Re Add::Apply(const _T1& lhs, const _T2& rhs)
+        {
+            if constexpr (Type::IsSame<_Re, Variant>)
+                return AsVariant(lhs) + rhs;
+            else
+                return static_cast<_Re>(lhs + rhs);
+        }
+
+
+        template <typename _Re, typename _T1, typename _T2>
+        inline _Re Subtract::Apply(const _T1& lhs, const _T2& rhs)
+        {
+            if constexpr (Type::IsSame<_Re, Variant>)
+                return AsVariant(lhs) - rhs;
+            else
+                return static_cast<_Re>(lhs - rhs);
+        }
+
+
+        template <typename _Re, typename _T1, typename _T2>
+        inline _Re Multiply::Apply(const _T1& lhs, const _T2& rhs)
+        {
+            if constexpr (Type::IsSame<_Re, Variant>)
+                return AsVariant(lhs) * rhs;
+            else
+                return static_cast<_Re>(lhs * rhs);
+        }
+
+
+        template <typename _Re, typename _T1, typename _T2>
+        inline _Re Divide::Apply(const _T1& lhs, const _T2& rhs)
+        {
+            if constexpr (Type::IsSame<_Re, Variant>)
+                return AsVariant(lhs) / rhs;
+            else
+                return static_cast<_Re>(lhs) / static_cast<_Re>(rhs);
+        }
+
+
+        template <typename _Re, typename _T1>
+        inline _Re Negate::Apply(const _T1& arg)
+        {
+            return static_cast<_Re>(-arg);
+        }
+
+
+        //
+        // Converts an evaluated expression element into the destination Array's
+        // type. Floating-point values truncate into integer Arrays as a cast would,
+        // but must fit (a quotient by zero doesn't).
+        //
+        template <ArrayValue _To, typename _Fr>
+        inline _To ConvertElement(const _Fr& value)
+        {
+            if constexpr (Type::IsSame<_To, _Fr>)
+                return value;
+            else if constexpr (Type::IsSame<_To, Variant>)
+                return Variant{value};
+            else if constexpr (std::is_floating_point_v<_Fr> && std::is_integral_v<_To>)
+            {
+                const double truncated = std::trunc((double)value);
+
+                if (!(truncated >= (double)std::numeric_limits<_To>::min() && truncated < (double)std::numeric_limits<_To>::max() + 1.0))
+                    MXL_THROW("Invalid conversion; value out of range of the Array element type");
+
+                return (_To)truncated;
+            }
+            else
+                return static_cast<_To>(value);
+        }
+    }
+
+
+    template <typename _Op, typename _Lhs, typename _Rhs>
+    inline BinaryExpression<_Op, _Lhs, _Rhs>::BinaryExpression(const _Lhs& lhs, const _Rhs& rhs)
+        : _Left{lhs}, _Right{rhs}
+    {
+        if constexpr (!_Lhs::IsScalar && !_Rhs::IsScalar)
+        {
+            if (lhs.Rows() != rhs.Rows() || lhs.Columns() != rhs.Columns())
+                MXL_THROW("Invalid attempt to combine Arrays of different shapes");
+        }
+    }
+
+
+    template <typename _Op, typename _Lhs, typename _Rhs>
+    inline uint64_t BinaryExpression<_Op, _Lhs, _Rhs>::Rows() const
+    {
+        if constexpr (_Lhs::IsScalar)
+            return _Right.Rows();
+        else
+            return _Left.Rows();
+    }
+
+
+    template <typename _Op, typename _Lhs, typename _Rhs>
+    inline uint64_t BinaryExpression<_Op, _Lhs, _Rhs>::Columns() const
+    {
+        if constexpr (_Lhs::IsScalar)
+            return _Right.Columns();
+        else
+            return _Left.Columns();
+    }
+
+
+    template <typename _Op, typename _Lhs, typename _Rhs>
+    inline uint64_t BinaryExpression<_Op, _Lhs, _Rhs>::Size() const
+    {
+        return Rows() * Columns();
+    }
+
+
+    template <typename _Op, typename _Lhs, typename _Rhs>
+    inline auto BinaryExpression<_Op, _Lhs, _Rhs>::operator[](const uint64_t index) const -> ValueType
+    {
+        return _Op::template Apply<ValueType>(_Left[index], _Right[index]);
+    }
+
+
+    template <typename _Op, typename _Arg>
+    inline UnaryExpression<_Op, _Arg>::UnaryExpression(const _Arg& arg): _Argument{arg}
+    {
+    }
+
+
+    template <typename _Op, typename _Arg>
+    inline uint64_t UnaryExpression<_Op, _Arg>::Rows() const
+    {
+        return _Argument.Rows();
+    }
+
+
+    template <typename _Op, typename _Arg>
+    inline uint64_t UnaryExpression<_Op, _Arg>::Columns() const
+    {
+        return _Argument.Columns();
+    }
+
+
+    template <typename _Op, typename _Arg>
+    inline uint64_t UnaryExpression<_Op, _Arg>::Size() const
+    {
+        return Rows() * Columns();
+    }
+
+
+    template <typename _Op, typename _Arg>
+    inline auto UnaryExpression<_Op, _Arg>::operator[](const uint64_t index) const -> ValueType
+    {
+        return _Op::template Apply<ValueType>(_Argument[index]);
+    }
+
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    inline auto operator+(const _T1& lhs, const _T2& rhs)
+    {
+        return BinaryExpression<Detail::Add, Detail::Leaf<_T1>, Detail::Leaf<_T2>>{lhs, rhs};
+    }
+
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    inline auto operator-(const _T1& lhs, const _T2& rhs)
+    {
+        return BinaryExpression<Detail::Subtract, Detail::Leaf<_T1>, Detail::Leaf<_T2>>{lhs, rhs};
+    }
+
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    inline auto operator*(const _T1& lhs, const _T2& rhs)
+    {
+        return BinaryExpression<Detail::Multiply, Detail::Leaf<_T1>, Detail::Leaf<_T2>>{lhs, rhs};
+    }
+
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    inline auto operator/(const _T1& lhs, const _T2& rhs)
+    {
+        return BinaryExpression<Detail::Divide, Detail::Leaf<_T1>, Detail::Leaf<_T2>>{lhs, rhs};
+    }
+
+
+    template <ExpressionOperand _Ty> requires (!Numeric<_Ty>)
+    inline auto operator-(const _Ty& arg)
+    {
+        return UnaryExpression<Detail::Negate, Detail::Leaf<_Ty>>{arg};
+    }
+
+
+    //
+    // Evaluates the expression into a newly allocated Array in a single pass.
+    //
+    template<ArrayValue _Ty>
+    template<ArrayExpression _Ex>
+    inline Array<_Ty>::Array(const _Ex& expr)
+        requires Type::IsSame<_Ty, Variant> || (!Type::IsSame<typename _Ex::ValueType, Variant>)
+        : Array<_Ty>(expr.Rows(), expr.Columns())
+    {
+        if (expr.Size() && !Data())
+            MXL_THROW("Dynamic allocation failed.");
+
+        auto out = Data();
+
+        for (uint64_t i = 0, n = expr.Size(); i < n; i++)
+            out[i] = Detail::ConvertElement<_Ty>(expr[i]);
+    }
+
+
+    //
+    // Evaluates the expression into this Array. The existing buffer is reused when the
+    // shapes match, which also makes self-referencing expressions (a = a * 2) safe.
+    //
+    template<ArrayValue _Ty>
+    template<ArrayExpression _Ex>
+    inline Array<_Ty>& Array<_Ty>::operator=(const _Ex& expr)
+        requires Type::IsSame<_Ty, Variant> || (!Type::IsSame<typename _Ex::ValueType, Variant>)
+    {
+        if (Rows() == expr.Rows() && Columns() == expr.Columns())
+        {
+            auto out = Data();
+
+            for (uint64_t i = 0, n = expr.Size(); i < n; i++)
+                out[i] = Detail::ConvertElement<_Ty>(expr[i]);
+        }
+        else
+        {
+            Array<_Ty> temp{expr};
+
+            std::swap(_Header, temp._Header);
+            std::swap(_Body, temp._Body);
+        }
+
+        return *this;
+    }
+
+
+    template <ArrayExpression _Ex>
+    inline Variant::Variant(const _Ex& expr): Variant(Array<typename _Ex::ValueType>{expr})
+    {
+    }
+}
\ No newline at end of file
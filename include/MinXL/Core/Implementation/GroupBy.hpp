@@ -0,0 +1,247 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/GroupBy.hpp"
+#include "MinXL/Core/Interface/Sort.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+#include "MinXL/Core/Interface/View.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        //
+        // Group key of a single cell. Text keys carry their case-insensitive hash
+        // instead of the sort prefix, so equal keys always have equal values.
+        //
+        inline SortCell GroupKey(const Variant& cell)
+        {
+            auto key = SortCell::Of(cell);
+
+            if (key.Class == SortClass::Text)
+                key.Key = static_cast<const String&>(cell).Hash(CaseSensitivity::Insensitive);
+
+            return key;
+        }
+
+
+        struct AggregateState
+        {
+            double      Sum     = 0.0;
+            double      Min     = std::numeric_limits<double>::infinity();
+            double      Max     = -std::numeric_limits<double>::infinity();
+            uint64_t    Numbers = 0;
+            Variant     Error;      // First error value in the group, if any
+        };
+    }
+
+
+    //
+    // Rows are first assigned a group id through a single open-addressing hash
+    // pass over the key columns; each aggregation then streams down its own
+    // column, so the table is only ever read column by column.
+    //
+    inline Array<Variant> GroupBy(const Array<Variant>& table, const std::vector<uint64_t>& keys, const std::vector<Aggregation>& aggregations)
+    {
+        for (auto col : keys)
+        {
+            if (col >= table.Columns())
+                MXL_THROW("GroupBy key column out of range");
+        }
+
+        for (auto& aggregation : aggregations)
+        {
+            if (aggregation.Column >= table.Columns())
+                MXL_THROW("GroupBy aggregation column out of range");
+        }
+
+        constexpr uint64_t none = std::numeric_limits<uint64_t>::max();
+
+        const uint64_t rows = table.Rows();
+        const uint64_t width = keys.size();
+
+        // Key cells, row by row, plus one combined hash per row
+
+        std::vector<Detail::SortCell>   cells(rows * width);
+        std::vector<uint64_t>           hashes(rows, 0);
+
+        for (uint64_t k = 0; k < width; k++)
+        {
+            const auto column = table.ColumnView(keys[k]);
+
+            for (uint64_t row = 0; row < rows; row++)
+            {
+                const auto cell = Detail::GroupKey(column[row]);
+
+                cells[row * width + k] = cell;
+                hashes[row] = Detail::HashFinal(hashes[row] ^ cell.Key) + (uint64_t)cell.Class;
+            }
+        }
+
+        auto sameKeys = [&](const uint64_t lhs, const uint64_t rhs)
+        {
+            for (uint64_t k = 0; k < width; k++)
+            {
+                const auto& a = cells[lhs * width + k];
+                const auto& b = cells[rhs * width + k];
+
+                if (a.Class != b.Class || a.Key != b.Key)
+                    return false;
+
+                if (a.Class == Detail::SortClass::Text)
+                {
+                    auto& textA = static_cast<const String&>(table(lhs, keys[k]));
+                    auto& textB = static_cast<const String&>(table(rhs, keys[k]));
+
+                    if (!textA.Equals(textB, CaseSensitivity::Insensitive))
+                        return false;
+                }
+            }
+
+            return true;
+        };
+
+        // Assign every row to a group (groups are numbered by first appearance)
+
+        std::vector<uint64_t>   groupOf(rows);
+        std::vector<uint64_t>   firstRows;
+        std::vector<uint64_t>   slots(16, none);
+
+        for (uint64_t row = 0; row < rows; row++)
+        {
+            // Keep the load factor at or below 50%
+            if ((firstRows.size() + 1) * 2 > slots.size())
+            {
+                slots.assign(slots.size() * 2, none);
+
+                for (uint64_t group = 0; group < firstRows.size(); group++)
+                {
+                    uint64_t i = hashes[firstRows[group]] & (slots.size() - 1);
+
+                    while (slots[i] != none)
+                        i = (i + 1) & (slots.size() - 1);
+
+                    slots[i] = group;
+                }
+            }
+
+            const uint64_t mask = slots.size() - 1;
+            const uint64_t hash = hashes[row];
+
+            for (uint64_t i = hash & mask;; i = (i + 1) & mask)
+            {
+                const uint64_t group = slots[i];
+
+                if (group == none)
+                {
+                    slots[i] = groupOf[row] = firstRows.size();
+                    firstRows.push_back(row);
+                    break;
+                }
+
+                if (hashes[firstRows[group]] == hash && sameKeys(firstRows[group], row))
+                {
+                    groupOf[row] = group;
+                    break;
+                }
+            }
+        }
+
+        // Aggregate, one column scan per numeric aggregation
+
+        const uint64_t groups = firstRows.size();
+        const uint64_t count = aggregations.size();
+
+        std::vector<uint64_t>                   groupRows(groups, 0);
+        std::vector<Detail::AggregateState>     states(groups * count);
+
+        for (uint64_t row = 0; row < rows; row++)
+            groupRows[groupOf[row]]++;
+
+        for (uint64_t a = 0; a < count; a++)
+        {
+            const auto function = aggregations[a].Function;
+
+            if (function == Aggregate::Count || function == Aggregate::First)
+                continue;
+
+            const auto column = table.ColumnView(aggregations[a].Column);
+
+            for (uint64_t row = 0; row < rows; row++)
+            {
+                const auto cell = Detail::SortCell::Of(column[row]);
+                auto& state = states[groupOf[row] * count + a];
+
+                // As in SUMIFS, an error in the aggregated range becomes the result
+                if (column[row].IsError())
+                {
+                    if (!state.Error.IsError())
+                        state.Error = column[row];
+
+                    continue;
+                }
+
+                if (cell.Class != Detail::SortClass::Number)
+                    continue;
+
+                const double value = Detail::FromOrderedBits(cell.Key);
+
+                state.Sum += value;
+                state.Min = std::min(state.Min, value);
+                state.Max = std::max(state.Max, value);
+                state.Numbers++;
+            }
+        }
+
+        // Key values, then one column per aggregation
+
+        Array<Variant> result(groups, width + count);
+
+        for (uint64_t k = 0; k < width; k++)
+        {
+            for (uint64_t group = 0; group < groups; group++)
+                result(group, k) = table(firstRows[group], keys[k]);
+        }
+
+        for (uint64_t a = 0; a < count; a++)
+        {
+            const uint64_t col = width + a;
+
+            for (uint64_t group = 0; group < groups; group++)
+            {
+                const auto& state = states[group * count + a];
+
+                if (state.Error.IsError())
+                {
+                    result(group, col) = state.Error;
+                    continue;
+                }
+
+                switch (aggregations[a].Function)
+                {
+                    case Aggregate::Sum:    result(group, col) = state.Sum;                             break;
+                    case Aggregate::Count:  result(group, col) = (double)groupRows[group];              break;
+                    case Aggregate::Min:    result(group, col) = state.Numbers ? state.Min : 0.0;       break;
+                    case Aggregate::Max:    result(group, col) = state.Numbers ? state.Max : 0.0;       break;
+                    case Aggregate::First:  result(group, col) = table(firstRows[group], aggregations[a].Column); break;
+
+                    case Aggregate::Mean:
+                    {
+                        if (state.Numbers)
+                            result(group, col) = state.Sum / (double)state.Numbers;
+                        else
+                            result(group, col) = CellError::Div0;
+
+                        break;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+}
\ No newline at end of file
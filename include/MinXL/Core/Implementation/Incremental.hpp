@@ -0,0 +1,235 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Cache.hpp"
+#include "MinXL/Core/Interface/Incremental.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        //
+        // Byte-wise equality, 64 bytes per step with SSE2/NEON.
+        //
+        inline bool BytesEqual(const void* lhs, const void* rhs, const uint64_t size)
+        {
+            auto a = static_cast<const std::byte*>(lhs);
+            auto b = static_cast<const std::byte*>(rhs);
+
+            uint64_t i = 0;
+
+#if defined(__SSE2__)
+            auto load = [](const std::byte* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+
+            for (; i + 64 <= size; i += 64)
+            {
+                const __m128i diff = _mm_or_si128(
+                    _mm_or_si128(_mm_xor_si128(load(a + i),      load(b + i)),      _mm_xor_si128(load(a + i + 16), load(b + i + 16))),
+                    _mm_or_si128(_mm_xor_si128(load(a + i + 32), load(b + i + 32)), _mm_xor_si128(load(a + i + 48), load(b + i + 48)))
+                );
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xFFFF)
+                    return false;
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            auto load = [](const std::byte* p) { return vld1q_u8(reinterpret_cast<const uint8_t*>(p)); };
+
+            for (; i + 64 <= size; i += 64)
+            {
+                const uint8x16_t diff = vorrq_u8(
+                    vorrq_u8(veorq_u8(load(a + i),      load(b + i)),      veorq_u8(load(a + i + 16), load(b + i + 16))),
+                    vorrq_u8(veorq_u8(load(a + i + 32), load(b + i + 32)), veorq_u8(load(a + i + 48), load(b + i + 48)))
+                );
+
+                if (vmaxvq_u8(diff) != 0)
+                    return false;
+            }
+#endif
+
+            return std::memcmp(a + i, b + i, size - i) == 0;
+        }
+
+
+        //
+        // Exact equality of two cells whose raw bytes differ. Only strings and
+        // arrays can still be equal, since they compare what they point to; an
+        // array that cannot be fingerprinted is taken to have changed.
+        //
+        inline bool SameCell(const Variant& lhs, const Variant& rhs)
+        {
+            if (lhs.TypeID() != rhs.TypeID())
+                return false;
+
+            if (lhs.IsString())
+                return static_cast<const String&>(lhs) == static_cast<const String&>(rhs);
+
+            if (lhs.IsArray())
+            {
+                try
+                {
+                    return Fingerprint(lhs) == Fingerprint(rhs);
+                }
+                catch (const Exception&)
+                {
+                    return false;
+                }
+            }
+
+            return false;
+        }
+    }
+
+
+    inline std::vector<uint64_t> ChangedRows(const Array<Variant>& previous, const Array<Variant>& current)
+    {
+        if (previous.Rows() != current.Rows() || previous.Columns() != current.Columns())
+            MXL_THROW("ChangedRows requires arrays of the same shape");
+
+        // Eight cells (192 bytes) per block
+        constexpr uint64_t block = 8;
+
+        const uint64_t rows = current.Rows();
+
+        std::vector<uint8_t> dirty(rows, 0);
+
+        for (uint64_t col = 0; col < current.Columns(); col++)
+        {
+            const Variant* before   = previous.Data() + col * rows;
+            const Variant* after    = current.Data() + col * rows;
+
+            for (uint64_t first = 0; first < rows; first += block)
+            {
+                const uint64_t last = std::min(first + block, rows);
+
+                if (Detail::BytesEqual(before + first, after + first, (last - first) * sizeof(Variant)))
+                    continue;
+
+                for (auto row = first; row < last; row++)
+                {
+                    if (dirty[row] || Detail::BytesEqual(before + row, after + row, sizeof(Variant)))
+                        continue;
+
+                    dirty[row] = !Detail::SameCell(before[row], after[row]);
+                }
+            }
+        }
+
+        std::vector<uint64_t> changed;
+
+        for (uint64_t row = 0; row < rows; row++)
+        {
+            if (dirty[row])
+                changed.push_back(row);
+        }
+
+        return changed;
+    }
+
+
+    template <typename _Fn>
+    inline Array<Variant> IncrementalCache::Update(const uint64_t site, const Array<Variant>& input, const uint64_t outputColumns, _Fn&& kernel)
+    {
+        // Holding the shared_ptr keeps the site alive even if it is forgotten meanwhile
+        const auto handle = GetSite(site);
+        auto& entry = *handle;
+
+        std::lock_guard lock{entry.Lock};
+
+        const bool full = !entry.Valid
+            || entry.Input.Rows() != input.Rows()
+            || entry.Input.Columns() != input.Columns()
+            || entry.Output.Columns() != outputColumns;
+
+        std::vector<uint64_t> rows;
+
+        if (full)
+        {
+            rows.resize(input.Rows());
+            std::iota(rows.begin(), rows.end(), 0);
+        }
+        else
+        {
+            rows = ChangedRows(entry.Input, input);
+        }
+
+        Array<Variant> patch(rows.size(), outputColumns);
+
+        if (!rows.empty())
+            kernel(input, static_cast<const std::vector<uint64_t>&>(rows), patch);
+
+        // What we keep must not live in the caller's arena
+        Arena::Bypass bypass;
+
+        if (full)
+        {
+            // Even with no rows: an empty input must not bring back the old output
+            Array<Variant> inputCopy{input};
+            Array<Variant> outputCopy{patch};
+
+            std::swap(entry.Input, inputCopy);
+            std::swap(entry.Output, outputCopy);
+
+            entry.Valid = true;
+        }
+        else
+        {
+            for (uint64_t i = 0; i < rows.size(); i++)
+            {
+                for (uint64_t col = 0; col < input.Columns(); col++)
+                    entry.Input(rows[i], col) = input(rows[i], col);
+
+                for (uint64_t col = 0; col < outputColumns; col++)
+                    entry.Output(rows[i], col) = patch(i, col);
+            }
+        }
+
+        return Array<Variant>{entry.Output};
+    }
+
+
+    inline void IncrementalCache::Forget(const uint64_t site)
+    {
+        std::lock_guard lock{_Lock};
+        _Sites.erase(site);
+    }
+
+
+    inline void IncrementalCache::Clear()
+    {
+        std::lock_guard lock{_Lock};
+        _Sites.clear();
+    }
+
+
+    inline uint64_t IncrementalCache::Size()
+    {
+        std::lock_guard lock{_Lock};
+        return _Sites.size();
+    }
+
+
+    inline IncrementalCache& IncrementalCache::Global()
+    {
+        static IncrementalCache cache;
+        return cache;
+    }
+
+
+    inline std::shared_ptr<IncrementalCache::Site> IncrementalCache::GetSite(const uint64_t site)
+    {
+        std::lock_guard lock{_Lock};
+
+        auto& entry = _Sites[site];
+
+        if (!entry)
+            entry = std::make_shared<Site>();
+
+        return entry;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Arena.hpp"
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Lookup.hpp"
+#include "MinXL/Core/Interface/Parallel.hpp"
+#include "MinXL/Core/Interface/Sort.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+#include "MinXL/Core/Interface/View.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        // Power-of-two table size keeping the load factor at or below 50%
+        inline uint64_t LookupCapacity(const uint64_t count)
+        {
+            return std::bit_ceil(std::max<uint64_t>(count * 2, 16));
+        }
+
+
+        template <ArrayValue _Ty>
+        inline _Ty LookupMissing()
+        {
+            if constexpr (Type::IsSame<_Ty, Variant>)
+                return Variant{CellError::NA};
+            else
+                return _Ty{};
+        }
+    }
+
+
+    inline LookupIndex::LookupIndex(StridedView<const Variant> keys): _Bools{NotFound, NotFound}, _Rows{keys.Size()}
+    {
+        Build(keys);
+    }
+
+
+    template <Numeric _Ty>
+    inline LookupIndex::LookupIndex(StridedView<_Ty> keys): _Bools{NotFound, NotFound}, _Rows{keys.Size()}
+    {
+        _Numbers.assign(Detail::LookupCapacity(keys.Size()), Slot{0, NotFound});
+        _Text.assign(Detail::LookupCapacity(0), Slot{0, NotFound});
+        _TextKeys.assign(_Text.size(), 0);
+
+        for (uint64_t row = 0; row < keys.Size(); row++)
+            InsertNumber(Detail::OrderedBits((double)keys[row]), row);
+    }
+
+
+    template <ArrayValue _Ty>
+    inline LookupIndex::LookupIndex(const Array<_Ty>& array, const uint64_t col): LookupIndex(array.ColumnView(col))
+    {
+    }
+
+
+    inline void LookupIndex::Build(StridedView<const Variant> keys)
+    {
+        std::vector<Detail::SortCell> cells(keys.Size());
+
+        uint64_t numbers = 0;
+        uint64_t text = 0;
+
+        for (uint64_t row = 0; row < keys.Size(); row++)
+        {
+            cells[row] = Detail::SortCell::Of(keys[row]);
+
+            numbers += cells[row].Class == Detail::SortClass::Number;
+            text    += cells[row].Class == Detail::SortClass::Text;
+        }
+
+        _Numbers.assign(Detail::LookupCapacity(numbers), Slot{0, NotFound});
+        _Text.assign(Detail::LookupCapacity(text), Slot{0, NotFound});
+        _TextKeys.assign(_Text.size(), 0);
+
+        // Our string copies must outlive any ArenaScope active right now;
+        // reserving up front keeps them from ever being relocated
+        Arena::Bypass bypass;
+        _Strings.reserve(text);
+
+        for (uint64_t row = 0; row < keys.Size(); row++)
+        {
+            const auto& cell = cells[row];
+
+            switch (cell.Class)
+            {
+                case Detail::SortClass::Number:
+                    InsertNumber(cell.Key, row);
+                    break;
+
+                case Detail::SortClass::Text:
+                    InsertText(static_cast<const String&>(keys[row]), row);
+                    break;
+
+                case Detail::SortClass::Bool:
+                    if (_Bools[cell.Key] == NotFound)
+                        _Bools[cell.Key] = row;
+                    break;
+
+                default: ;
+            }
+        }
+    }
+
+
+    inline void LookupIndex::InsertNumber(const uint64_t key, const uint64_t row)
+    {
+        const uint64_t mask = _Numbers.size() - 1;
+
+        for (uint64_t i = Detail::HashFinal(key) & mask;; i = (i + 1) & mask)
+        {
+            auto& slot = _Numbers[i];
+
+            if (slot.Row == NotFound)
+            {
+                slot = Slot{key, row};
+                return;
+            }
+
+            // Duplicate: the first row keeps the slot
+            if (slot.Key == key)
+                return;
+        }
+    }
+
+
+    inline void LookupIndex::InsertText(const String& key, const uint64_t row)
+    {
+        const uint64_t mask = _Text.size() - 1;
+        const uint64_t hash = key.Hash(CaseSensitivity::Insensitive);
+
+        for (uint64_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            auto& slot = _Text[i];
+
+            if (slot.Row == NotFound)
+            {
+                slot = Slot{hash, row};
+                _TextKeys[i] = _Strings.size();
+                _Strings.push_back(key);
+
+                return;
+            }
+
+            if (slot.Key == hash && _Strings[_TextKeys[i]].Equals(key, CaseSensitivity::Insensitive))
+                return;
+        }
+    }
+
+
+    inline uint64_t LookupIndex::FindNumber(const uint64_t key) const
+    {
+        const uint64_t mask = _Numbers.size() - 1;
+
+        for (uint64_t i = Detail::HashFinal(key) & mask;; i = (i + 1) & mask)
+        {
+            const auto& slot = _Numbers[i];
+
+            if (slot.Row == NotFound || slot.Key == key)
+                return slot.Row;
+        }
+    }
+
+
+    inline uint64_t LookupIndex::FindText(const String& needle) const
+    {
+        const uint64_t mask = _Text.size() - 1;
+        const uint64_t hash = needle.Hash(CaseSensitivity::Insensitive);
+
+        for (uint64_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            const auto& slot = _Text[i];
+
+            if (slot.Row == NotFound)
+                return NotFound;
+
+            if (slot.Key == hash && _Strings[_TextKeys[i]].Equals(needle, CaseSensitivity::Insensitive))
+                return slot.Row;
+        }
+    }
+
+
+    inline uint64_t LookupIndex::Find(const Variant& needle) const
+    {
+        const auto cell = Detail::SortCell::Of(needle);
+
+        switch (cell.Class)
+        {
+            case Detail::SortClass::Number: return FindNumber(cell.Key);
+            case Detail::SortClass::Text:   return FindText(static_cast<const String&>(needle));
+            case Detail::SortClass::Bool:   return _Bools[cell.Key];
+            default:                        return NotFound;
+        }
+    }
+
+
+    template <Numeric _Ty>
+    inline uint64_t LookupIndex::Find(const _Ty needle) const
+    {
+        return FindNumber(Detail::OrderedBits((double)needle));
+    }
+
+
+    inline std::vector<uint64_t> LookupIndex::Find(StridedView<const Variant> needles, const bool parallel) const
+    {
+        std::vector<uint64_t> rows(needles.Size());
+
+        auto resolve = [&](uint64_t first, uint64_t last)
+        {
+            for (auto i = first; i < last; i++)
+                rows[i] = Find(needles[i]);
+        };
+
+        if (parallel)
+            ParallelFor(0, needles.Size(), resolve);
+        else
+            resolve(0, needles.Size());
+
+        return rows;
+    }
+
+
+    template <Numeric _Ty>
+    inline std::vector<uint64_t> LookupIndex::Find(StridedView<_Ty> needles, const bool parallel) const
+    {
+        std::vector<uint64_t> rows(needles.Size());
+
+        auto resolve = [&](uint64_t first, uint64_t last)
+        {
+            for (auto i = first; i < last; i++)
+                rows[i] = Find(needles[i]);
+        };
+
+        if (parallel)
+            ParallelFor(0, needles.Size(), resolve);
+        else
+            resolve(0, needles.Size());
+
+        return rows;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline Array<_Ty> LookupIndex::Gather(StridedView<const Variant> needles, const Array<_Ty>& values, const _Ty& ifNotFound, const bool parallel) const
+    {
+        if (values.Rows() != _Rows)
+            MXL_THROW("Gather values must have one row per indexed key");
+
+        const auto rows = Find(needles, parallel);
+
+        Array<_Ty> result(rows.size(), values.Columns());
+
+        auto gather = [&](uint64_t first, uint64_t last)
+        {
+            for (uint64_t col = 0; col < values.Columns(); col++)
+            {
+                for (auto i = first; i < last; i++)
+                {
+                    if (rows[i] != NotFound)
+                        result(i, col) = values(rows[i], col);
+                    else if constexpr (Type::IsSame<_Ty, Variant>)
+                        result(i, col) = needles[i].IsError() ? needles[i] : ifNotFound;
+                    else
+                        result(i, col) = ifNotFound;
+                }
+            }
+        };
+
+        if (parallel)
+            ParallelFor(0, rows.size(), gather);
+        else
+            gather(0, rows.size());
+
+        return result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Output.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+
+namespace mxl
+{
+    template <ArrayValue _Ty>
+    inline Array<_Ty>& PrepareOutput(Variant& target, const uint64_t rows, const uint64_t cols)
+    {
+        if (auto existing = target.TryAs<Array<_Ty>>())
+        {
+            auto& array = *existing;
+
+            if (array.Dimensions() == 2 && array.ElementSize() == sizeof(_Ty) && array.Rows() == rows && array.Columns() == cols && array.Data())
+                return array;
+        }
+
+        if (target.IsArray() && target._Value.Array)
+        {
+            constexpr uint16_t hostOwned = (uint16_t)ArrayFeatures::Auto | (uint16_t)ArrayFeatures::Static
+                | (uint16_t)ArrayFeatures::Embedded | (uint16_t)ArrayFeatures::FixedSize;
+
+            const auto& body = *target._Value.Array;
+
+            if ((body.Features & hostOwned) || body.Locks)
+                MXL_THROW("Invalid attempt to replace a fixed-size or locked Array; pass a Variant that holds a dynamic Array");
+        }
+
+        Array<_Ty> array(rows, cols);
+
+        if (array.Size() != rows * cols)
+            MXL_THROW("Dynamic allocation failed.");
+
+        target = Variant{std::move(array)};
+
+        return static_cast<Array<_Ty>&>(target);
+    }
+}
\ No newline at end of file
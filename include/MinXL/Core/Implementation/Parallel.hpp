@@ -0,0 +1,282 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Parallel.hpp"
+
+
+namespace mxl
+{
+    //
+    // Returns the process-wide pool, creating it on first use. The calling thread
+    // always participates, so one fewer worker than hardware threads is spawned.
+    //
+    inline ThreadPool& ThreadPool::Instance()
+    {
+        static ThreadPool pool{std::max<uint64_t>(std::thread::hardware_concurrency(), 1) - 1};
+        return pool;
+    }
+
+
+    inline ThreadPool::ThreadPool(const uint64_t workers): _Pending{0}, _NextQueue{0}, _Stop{false}
+    {
+        // One deque per worker plus one shared by outside callers
+        for (uint64_t i = 0; i < workers + 1; i++)
+            _Queues.push_back(std::make_unique<Queue>());
+
+        for (uint64_t i = 0; i < workers; i++)
+            _Workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+
+
+    inline ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock{_SleepLock};
+            _Stop = true;
+        }
+
+        _Wake.notify_all();
+
+        for (auto& worker : _Workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+    }
+
+
+    inline uint64_t ThreadPool::Concurrency() const
+    {
+        return _Workers.size() + 1;
+    }
+
+
+    inline void ThreadPool::Dispatch(const uint64_t count, const std::function<void(uint64_t)>& job)
+    {
+        if (count == 0)
+            return;
+
+        // Nothing to share the work with
+        if (_Workers.empty() || count == 1)
+        {
+            for (uint64_t i = 0; i < count; i++)
+                job(i);
+
+            return;
+        }
+
+        Batch batch{&job, count, nullptr, {}};
+
+        // Deal tasks round-robin so every worker starts with local work
+        const uint64_t first = _NextQueue.fetch_add(1, std::memory_order_relaxed);
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+            auto& queue = *_Queues[(first + i) % _Queues.size()];
+
+            std::lock_guard lock{queue.Lock};
+            queue.Tasks.push_back(Task{&batch, i});
+        }
+
+        // Announce the tasks only once they can be taken, so woken workers find
+        // them instead of spinning. A worker already running may take some before
+        // this, which can make the counter briefly negative.
+        {
+            std::lock_guard lock{_SleepLock};
+            _Pending.fetch_add((int64_t)count, std::memory_order_release);
+        }
+
+        _Wake.notify_all();
+
+        // Help out until the whole batch is done
+        while (batch.Remaining.load(std::memory_order_acquire) > 0)
+        {
+            Task task;
+
+            if (TryAcquire(task))
+                Execute(task);
+            else
+                std::this_thread::yield();
+        }
+
+        if (batch.Error)
+            std::rethrow_exception(batch.Error);
+    }
+
+
+    inline void ThreadPool::WorkerLoop(const uint64_t index)
+    {
+        _WorkerIndex = index;
+
+        while (true)
+        {
+            Task task;
+
+            if (TryAcquire(task))
+            {
+                Execute(task);
+                continue;
+            }
+
+            std::unique_lock lock{_SleepLock};
+            _Wake.wait(lock, [this] { return _Stop || _Pending.load(std::memory_order_acquire) > 0; });
+
+            if (_Stop)
+                return;
+        }
+    }
+
+
+    // Owner end of a deque (most recently pushed, still warm in cache)
+    inline bool ThreadPool::TryPop(const uint64_t queue, Task& task)
+    {
+        auto& q = *_Queues[queue];
+        std::lock_guard lock{q.Lock};
+
+        if (q.Tasks.empty())
+            return false;
+
+        task = q.Tasks.back();
+        q.Tasks.pop_back();
+        _Pending.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+
+    // Thief end of every other deque, starting next to the thief
+    inline bool ThreadPool::TrySteal(const uint64_t thief, Task& task)
+    {
+        for (uint64_t offset = 1; offset <= _Queues.size(); offset++)
+        {
+            auto& q = *_Queues[(thief + offset) % _Queues.size()];
+            std::lock_guard lock{q.Lock};
+
+            if (q.Tasks.empty())
+                continue;
+
+            task = q.Tasks.front();
+            q.Tasks.pop_front();
+            _Pending.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        return false;
+    }
+
+
+    inline bool ThreadPool::TryAcquire(Task& task)
+    {
+        if (_Pending.load(std::memory_order_acquire) <= 0)
+            return false;
+
+        // Outside callers own the last deque
+        const uint64_t own = _WorkerIndex >= 0 ? (uint64_t)_WorkerIndex : _Queues.size() - 1;
+
+        return TryPop(own, task) || TrySteal(own, task);
+    }
+
+
+    inline void ThreadPool::Execute(const Task& task)
+    {
+        auto batch = task.Owner;
+
+        try
+        {
+            (*batch->Job)(task.Index);
+        }
+        catch (...)
+        {
+            std::lock_guard lock{batch->ErrorLock};
+
+            if (!batch->Error)
+                batch->Error = std::current_exception();
+        }
+
+        batch->Remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+
+    template <typename _Fn>
+    inline void ParallelFor(const uint64_t begin, const uint64_t end, _Fn&& fn, uint64_t grain)
+    {
+        if (begin >= end)
+            return;
+
+        auto& pool = ThreadPool::Instance();
+        const uint64_t count = end - begin;
+
+        if (grain == 0)
+            grain = std::max<uint64_t>(count / (pool.Concurrency() * 4), 1024);
+
+        const uint64_t chunks = (count + grain - 1) / grain;
+
+        if (chunks == 1)
+        {
+            fn(begin, end);
+            return;
+        }
+
+        pool.Dispatch(chunks, [&](uint64_t chunk)
+        {
+            const uint64_t first = begin + chunk * grain;
+            fn(first, std::min(first + grain, end));
+        });
+    }
+
+
+    template <typename _Re, typename _Map, typename _Combine>
+    inline _Re ParallelReduce(const uint64_t begin, const uint64_t end, _Re identity, _Map&& map, _Combine&& combine, uint64_t grain)
+    {
+        if (begin >= end)
+            return identity;
+
+        if (grain == 0)
+            grain = DefaultReduceGrain;
+
+        const uint64_t count    = end - begin;
+        const uint64_t chunks   = (count + grain - 1) / grain;
+
+        std::vector<_Re> partials(chunks, identity);
+
+        ThreadPool::Instance().Dispatch(chunks, [&](uint64_t chunk)
+        {
+            const uint64_t first = begin + chunk * grain;
+            partials[chunk] = map(first, std::min(first + grain, end));
+        });
+
+        for (auto& partial : partials)
+            identity = combine(std::move(identity), std::move(partial));
+
+        return identity;
+    }
+
+
+    template <ArrayValue _Ty, typename _Fn>
+    inline void ParallelFor(const Array<_Ty>& array, _Fn&& fn, uint64_t grain)
+    {
+        ParallelFor(0, array.Size(), std::forward<_Fn>(fn), grain);
+    }
+
+
+    template <ArrayValue _Ty, typename _Re, typename _Map, typename _Combine>
+    inline _Re ParallelReduce(const Array<_Ty>& array, _Re identity, _Map&& map, _Combine&& combine, uint64_t grain)
+    {
+        return ParallelReduce(0, array.Size(), std::move(identity), std::forward<_Map>(map), std::forward<_Combine>(combine), grain);
+    }
+
+
+    template <ArrayValue _Ty, typename _Fn>
+    inline void ParallelForColumns(const Array<_Ty>& array, _Fn&& fn, uint64_t grain)
+    {
+        ParallelFor(0, array.Columns(), [&](uint64_t first, uint64_t last)
+        {
+            for (uint64_t col = first; col < last; col++)
+                fn(col);
+        },
+        std::max<uint64_t>(grain, 1));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,479 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Profile.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        //
+        // Counters of one entry point on one thread. Only the owning thread
+        // writes (plain load + store, no read-modify-write); any thread may read.
+        //
+        struct ProfileCounters
+        {
+            std::atomic<uint64_t>   Calls{0};
+            std::atomic<uint64_t>   Cells{0};
+            std::atomic<uint64_t>   TotalNs{0};
+            std::atomic<uint64_t>   MaxNs{0};
+            std::atomic<uint64_t>   Cycles{0};
+            std::atomic<uint64_t>   Instructions{0};
+            std::atomic<uint64_t>   Histogram[Profile::Buckets] = {};
+        };
+
+
+        struct ProfileThread
+        {
+            std::atomic<ProfileCounters*>   Entries[Profile::MaxEntryPoints] = {};
+            int                             PerfGroup = -1;     // perf_event group leader (cycles), -1 if none
+            int                             PerfMember = -1;    // Instructions, read through the leader
+            bool                            PerfTried = false;
+        };
+
+
+        //
+        // Closes the perf events of a thread when it exits. ProfileThread itself
+        // is never freed, so its descriptors would otherwise leak per thread.
+        //
+        struct ProfilePerfOwner
+        {
+            ProfileThread* Thread = nullptr;
+
+            ~ProfilePerfOwner()
+            {
+#if defined(__linux__)
+                if (!Thread)
+                    return;
+
+                if (Thread->PerfMember >= 0)
+                    close(Thread->PerfMember);
+
+                if (Thread->PerfGroup >= 0)
+                    close(Thread->PerfGroup);
+
+                Thread->PerfMember = -1;
+                Thread->PerfGroup = -1;
+#endif
+            }
+        };
+
+
+        struct ProfileState
+        {
+            std::mutex                                      Lock;
+            std::vector<std::string>                        Names;
+            std::vector<std::unique_ptr<ProfileThread>>     Threads;        // Never freed, so readers can outlive threads
+            std::vector<std::unique_ptr<ProfileCounters>>   Counters;
+            std::atomic<bool>                               Hardware{false};
+        };
+
+
+        inline ProfileState& ProfileGlobal()
+        {
+            static ProfileState state;
+            return state;
+        }
+
+
+        inline ProfileThread& ProfileLocal()
+        {
+            thread_local ProfileThread* local = []
+            {
+                auto& global = ProfileGlobal();
+                std::lock_guard lock{global.Lock};
+
+                global.Threads.push_back(std::make_unique<ProfileThread>());
+                return global.Threads.back().get();
+            }();
+
+            return *local;
+        }
+
+
+        inline ProfileCounters& ProfileEntry(ProfileThread& thread, const uint32_t entry)
+        {
+            if (auto counters = thread.Entries[entry].load(std::memory_order_acquire))
+                return *counters;
+
+            auto& global = ProfileGlobal();
+            std::lock_guard lock{global.Lock};
+
+            global.Counters.push_back(std::make_unique<ProfileCounters>());
+            thread.Entries[entry].store(global.Counters.back().get(), std::memory_order_release);
+
+            return *global.Counters.back();
+        }
+
+
+        inline void ProfileAdd(std::atomic<uint64_t>& counter, const uint64_t value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+
+        // Log-linear bucket: exact below 16, then 16 sub-buckets per power of two
+        inline uint32_t ProfileBucket(const uint64_t ns)
+        {
+            if (ns < Profile::SubBuckets)
+                return (uint32_t)ns;
+
+            const uint32_t shift = (uint32_t)std::bit_width(ns) - 5;
+            return Profile::SubBuckets + shift * Profile::SubBuckets + (uint32_t)(ns >> shift) - Profile::SubBuckets;
+        }
+
+
+        // Midpoint of a bucket's range
+        inline uint64_t ProfileBucketValue(const uint32_t bucket)
+        {
+            if (bucket < Profile::SubBuckets)
+                return bucket;
+
+            const uint32_t shift = (bucket - Profile::SubBuckets) / Profile::SubBuckets;
+            const uint64_t base = (uint64_t)(Profile::SubBuckets + (bucket - Profile::SubBuckets) % Profile::SubBuckets) << shift;
+
+            return base + ((1ull << shift) >> 1);
+        }
+
+
+        inline uint64_t ProfileNow()
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+            ).count();
+        }
+
+
+        //
+        // Reads user-space cycles and instructions of the calling thread. Opens
+        // the perf events on first use; returns false if they are unavailable.
+        //
+        inline bool ProfileHardware(ProfileThread& thread, uint64_t (&values)[2])
+        {
+#if defined(__linux__)
+            if (!thread.PerfTried)
+            {
+                thread.PerfTried = true;
+
+                auto open = [](const uint64_t config, const int group)
+                {
+                    perf_event_attr attr{};
+                    attr.type           = PERF_TYPE_HARDWARE;
+                    attr.size           = sizeof(attr);
+                    attr.config         = config;
+                    attr.disabled       = group == -1;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv     = 1;
+                    attr.read_format    = PERF_FORMAT_GROUP;
+
+                    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+                };
+
+                const int leader = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+
+                if (leader >= 0)
+                {
+                    const int member = open(PERF_COUNT_HW_INSTRUCTIONS, leader);
+
+                    if (member >= 0)
+                    {
+                        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+                        thread.PerfGroup = leader;
+                        thread.PerfMember = member;
+
+                        thread_local ProfilePerfOwner owner;
+                        owner.Thread = &thread;
+                    }
+                    else
+                    {
+                        close(leader);
+                    }
+                }
+            }
+
+            if (thread.PerfGroup < 0)
+                return false;
+
+            // Group read: number of events, then their values
+            uint64_t buffer[3];
+
+            if (read(thread.PerfGroup, buffer, sizeof(buffer)) != (ssize_t)sizeof(buffer))
+                return false;
+
+            values[0] = buffer[1];
+            values[1] = buffer[2];
+
+            return true;
+#else
+            (void)thread;
+            (void)values;
+
+            return false;
+#endif
+        }
+    }
+
+
+    namespace Profile
+    {
+        inline Probe::Probe(const uint32_t entry, const uint64_t cells): _Entry{entry}, _Cells{cells}, _Hardware{0, 0}, _HasHardware{false}
+        {
+            if (Detail::ProfileGlobal().Hardware.load(std::memory_order_relaxed))
+                _HasHardware = Detail::ProfileHardware(Detail::ProfileLocal(), _Hardware);
+
+            _Start = Detail::ProfileNow();
+        }
+
+
+        inline Probe::~Probe()
+        {
+            const uint64_t elapsed = Detail::ProfileNow() - _Start;
+
+            auto& thread = Detail::ProfileLocal();
+            auto& counters = Detail::ProfileEntry(thread, _Entry);
+
+            Detail::ProfileAdd(counters.Calls, 1);
+            Detail::ProfileAdd(counters.Cells, _Cells);
+            Detail::ProfileAdd(counters.TotalNs, elapsed);
+            Detail::ProfileAdd(counters.Histogram[Detail::ProfileBucket(elapsed)], 1);
+
+            if (elapsed > counters.MaxNs.load(std::memory_order_relaxed))
+                counters.MaxNs.store(elapsed, std::memory_order_relaxed);
+
+            uint64_t hardware[2];
+
+            // Only if the start was read too; counters may have been switched on mid-call
+            if (_HasHardware && Detail::ProfileHardware(thread, hardware))
+            {
+                Detail::ProfileAdd(counters.Cycles, hardware[0] - _Hardware[0]);
+                Detail::ProfileAdd(counters.Instructions, hardware[1] - _Hardware[1]);
+            }
+        }
+
+
+        inline uint32_t Register(const char* name)
+        {
+            auto& global = Detail::ProfileGlobal();
+            std::lock_guard lock{global.Lock};
+
+            // The same name from several call sites is one entry point
+            for (uint32_t i = 0; i < global.Names.size(); i++)
+            {
+                if (global.Names[i] == name)
+                    return i;
+            }
+
+            if (global.Names.size() >= MaxEntryPoints)
+                MXL_THROW("Too many profiled entry points");
+
+            global.Names.emplace_back(name);
+
+            return (uint32_t)global.Names.size() - 1;
+        }
+
+
+        inline uint64_t Cells(const Variant& value)
+        {
+            if (!value.IsArray())
+                return 1;
+
+            auto cells = [](const auto& array)
+            {
+                return (uint64_t)array.Rows() * array.Columns();
+            };
+
+            switch (value.ArrayTypeID())
+            {
+                case Type::ID::Int16:   return cells(static_cast<const Array<int16_t>&>(value));
+                case Type::ID::Int32:   return cells(static_cast<const Array<int32_t>&>(value));
+                case Type::ID::Int64:   return cells(static_cast<const Array<int64_t>&>(value));
+                case Type::ID::Float:   return cells(static_cast<const Array<float>&>(value));
+                case Type::ID::Double:  return cells(static_cast<const Array<double>&>(value));
+                case Type::ID::Bool:    return cells(static_cast<const Array<Bool>&>(value));
+                case Type::ID::Byte:    return cells(static_cast<const Array<Byte>&>(value));
+                case Type::ID::Date:    return cells(static_cast<const Array<Date>&>(value));
+                case Type::ID::Variant: return cells(static_cast<const Array<Variant>&>(value));
+                default:                return 0;
+            }
+        }
+
+
+        inline bool EnableHardwareCounters(const bool enable)
+        {
+            auto& global = Detail::ProfileGlobal();
+
+            if (!enable)
+            {
+                global.Hardware.store(false, std::memory_order_relaxed);
+                return false;
+            }
+
+            uint64_t probe[2];
+            const bool available = Detail::ProfileHardware(Detail::ProfileLocal(), probe);
+
+            global.Hardware.store(available, std::memory_order_relaxed);
+            return available;
+        }
+
+
+        inline std::vector<EntryStats> Snapshot()
+        {
+            auto& global = Detail::ProfileGlobal();
+            std::lock_guard lock{global.Lock};
+
+            std::vector<EntryStats> stats;
+
+            for (uint32_t entry = 0; entry < global.Names.size(); entry++)
+            {
+                EntryStats entryStats{global.Names[entry], 0, 0, 0, 0, 0, 0, 0, 0, 0};
+                std::vector<uint64_t> histogram(Buckets, 0);
+
+                for (auto& thread : global.Threads)
+                {
+                    auto counters = thread->Entries[entry].load(std::memory_order_acquire);
+
+                    if (!counters)
+                        continue;
+
+                    entryStats.Calls        += counters->Calls.load(std::memory_order_relaxed);
+                    entryStats.Cells        += counters->Cells.load(std::memory_order_relaxed);
+                    entryStats.TotalNs      += counters->TotalNs.load(std::memory_order_relaxed);
+                    entryStats.MaxNs        = std::max(entryStats.MaxNs, counters->MaxNs.load(std::memory_order_relaxed));
+                    entryStats.Cycles       += counters->Cycles.load(std::memory_order_relaxed);
+                    entryStats.Instructions += counters->Instructions.load(std::memory_order_relaxed);
+
+                    for (uint32_t b = 0; b < Buckets; b++)
+                        histogram[b] += counters->Histogram[b].load(std::memory_order_relaxed);
+                }
+
+                if (entryStats.Calls == 0)
+                    continue;
+
+                const uint64_t total = std::accumulate(histogram.begin(), histogram.end(), uint64_t{0});
+
+                auto percentile = [&](const double fraction)
+                {
+                    const uint64_t rank = std::max<uint64_t>(1, (uint64_t)std::ceil(fraction * total));
+                    uint64_t seen = 0;
+
+                    for (uint32_t b = 0; b < Buckets; b++)
+                    {
+                        seen += histogram[b];
+
+                        if (seen >= rank)
+                            return std::min(Detail::ProfileBucketValue(b), entryStats.MaxNs);
+                    }
+
+                    return entryStats.MaxNs;
+                };
+
+                entryStats.P50Ns = percentile(0.50);
+                entryStats.P90Ns = percentile(0.90);
+                entryStats.P99Ns = percentile(0.99);
+
+                stats.push_back(std::move(entryStats));
+            }
+
+            return stats;
+        }
+
+
+        //
+        // Zeroes every counter. Calls finishing concurrently on other threads
+        // may be partly lost.
+        //
+        inline void Reset()
+        {
+            auto& global = Detail::ProfileGlobal();
+            std::lock_guard lock{global.Lock};
+
+            for (auto& counters : global.Counters)
+            {
+                for (auto counter : {&counters->Calls, &counters->Cells, &counters->TotalNs, &counters->MaxNs, &counters->Cycles, &counters->Instructions})
+                    counter->store(0, std::memory_order_relaxed);
+
+                for (auto& bucket : counters->Histogram)
+                    bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+
+        inline Array<Variant> Table()
+        {
+            const auto stats = Snapshot();
+
+            static constexpr const char* headers[] = {
+                "Entry", "Calls", "Cells", "Total ms", "Mean us", "P50 us", "P90 us", "P99 us", "Max us", "Cycles", "Instructions"
+            };
+
+            constexpr uint64_t columns = std::size(headers);
+
+            Array<Variant> table(stats.size() + 1, columns);
+
+            for (uint64_t col = 0; col < columns; col++)
+                table(0, col) = Variant{headers[col]};
+
+            for (uint64_t i = 0; i < stats.size(); i++)
+            {
+                const auto& entry = stats[i];
+                const uint64_t row = i + 1;
+
+                table(row, 0)   = Variant{entry.Name.c_str()};
+                table(row, 1)   = (double)entry.Calls;
+                table(row, 2)   = (double)entry.Cells;
+                table(row, 3)   = entry.TotalNs / 1e6;
+                table(row, 4)   = entry.TotalNs / 1e3 / entry.Calls;
+                table(row, 5)   = entry.P50Ns / 1e3;
+                table(row, 6)   = entry.P90Ns / 1e3;
+                table(row, 7)   = entry.P99Ns / 1e3;
+                table(row, 8)   = entry.MaxNs / 1e3;
+                table(row, 9)   = (double)entry.Cycles;
+                table(row, 10)  = (double)entry.Instructions;
+            }
+
+            return table;
+        }
+
+
+        inline void Dump(std::ostream& os)
+        {
+            char line[320];
+
+            std::snprintf(line, sizeof(line), "%-32s %10s %14s %12s %10s %10s %10s %10s %10s %16s %16s\n",
+                "Entry", "Calls", "Cells", "Total ms", "Mean us", "P50 us", "P90 us", "P99 us", "Max us", "Cycles", "Instructions");
+            os << line;
+
+            for (auto& entry : Snapshot())
+            {
+                std::snprintf(line, sizeof(line), "%-32s %10" PRIu64 " %14" PRIu64 " %12.3f %10.2f %10.2f %10.2f %10.2f %10.2f %16" PRIu64 " %16" PRIu64 "\n",
+                    entry.Name.c_str(), entry.Calls, entry.Cells, entry.TotalNs / 1e6, entry.TotalNs / 1e3 / entry.Calls,
+                    entry.P50Ns / 1e3, entry.P90Ns / 1e3, entry.P99Ns / 1e3, entry.MaxNs / 1e3, entry.Cycles, entry.Instructions);
+                os << line;
+            }
+        }
+
+
+        inline bool Dump(const std::string& path)
+        {
+            std::ofstream out{path};
+
+            if (!out)
+                return false;
+
+            Dump(out);
+            return true;
+        }
+    }
+}
\ No newline at end of file
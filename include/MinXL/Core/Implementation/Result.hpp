@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Result.hpp"
+
+
+namespace mxl
+{
+    template <typename _Ty>
+    inline _Ty& Result<_Ty>::Value() &
+    {
+        if (!_Value)
+            throw Exception{_Failure};
+
+        return *_Value;
+    }
+
+
+    template <typename _Ty>
+    inline const _Ty& Result<_Ty>::Value() const &
+    {
+        if (!_Value)
+            throw Exception{_Failure};
+
+        return *_Value;
+    }
+
+
+    template <typename _Ty>
+    inline _Ty&& Result<_Ty>::Value() &&
+    {
+        if (!_Value)
+            throw Exception{_Failure};
+
+        return std::move(*_Value);
+    }
+
+
+    template <typename _Ty>
+    inline _Ty Result<_Ty>::ValueOr(_Ty fallback) const &
+    {
+        return _Value ? *_Value : std::move(fallback);
+    }
+
+
+    template <typename _Ty>
+    inline _Ty Result<_Ty>::ValueOr(_Ty fallback) &&
+    {
+        return _Value ? std::move(*_Value) : std::move(fallback);
+    }
+
+
+    template <typename _Ty>
+    inline _Ty& Result<_Ty&>::Value() const
+    {
+        if (!_Value)
+            throw Exception{_Failure};
+
+        return *_Value;
+    }
+
+
+    template <typename _Ty>
+    inline _Ty& Result<_Ty&>::ValueOr(_Ty& fallback) const
+    {
+        return _Value ? *_Value : fallback;
+    }
+}
\ No newline at end of file
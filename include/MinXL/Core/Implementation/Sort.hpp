@@ -0,0 +1,402 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/Parallel.hpp"
+#include "MinXL/Core/Interface/Sort.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+#include "MinXL/Core/Interface/View.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        //
+        // Maps a double to an unsigned integer with the same ordering, so that
+        // numbers can be radix-sorted as plain 64-bit keys.
+        //
+        inline uint64_t OrderedBits(double value)
+        {
+            constexpr uint64_t sign = 1ull << 63;
+
+            // -0.0 sorts together with 0.0
+            if (value == 0.0)
+                value = 0.0;
+
+            const auto bits = std::bit_cast<uint64_t>(value);
+
+            return (bits & sign) ? ~bits : (bits | sign);
+        }
+
+
+        inline double FromOrderedBits(const uint64_t bits)
+        {
+            constexpr uint64_t sign = 1ull << 63;
+
+            return std::bit_cast<double>((bits & sign) ? (bits ^ sign) : ~bits);
+        }
+
+
+        template <Numeric _Ty>
+        inline uint64_t OrderedBits(const _Ty value)
+        {
+            if constexpr (std::is_integral_v<_Ty>)
+                return (uint64_t)(int64_t)value ^ (1ull << 63);
+            else
+                return OrderedBits((double)value);
+        }
+
+
+        //
+        // First four case-folded units of a string packed big-endian, so that
+        // comparing prefixes as integers agrees with String::Compare.
+        //
+        inline uint64_t TextPrefix(const String& str)
+        {
+            uint64_t prefix = 0;
+
+            for (uint64_t k = 0; k < 4; k++)
+            {
+                const uint64_t unit = k < str.Size() ? FoldCase(str.Buffer()[k]) : 0;
+                prefix = (prefix << 16) | unit;
+            }
+
+            return prefix;
+        }
+
+
+        inline SortCell SortCell::Of(const Variant& cell)
+        {
+            switch (cell._Type)
+            {
+                case Type::ID::Double:
+                case Type::ID::Date:    return {SortClass::Number,  OrderedBits(cell._Value.Double)};
+                case Type::ID::Int16:   return {SortClass::Number,  OrderedBits((double)cell._Value.Int16)};
+                case Type::ID::Int32:   return {SortClass::Number,  OrderedBits((double)cell._Value.Int32)};
+                case Type::ID::Int64:   return {SortClass::Number,  OrderedBits((double)cell._Value.Int64)};
+                case Type::ID::Float:   return {SortClass::Number,  OrderedBits((double)cell._Value.Float)};
+                case Type::ID::Byte:    return {SortClass::Number,  OrderedBits((double)cell._Value.Byte)};
+                case Type::ID::String:  return {SortClass::Text,    TextPrefix(static_cast<const String&>(cell))};
+                case Type::ID::Bool:    return {SortClass::Bool,    cell._Value.Int16 != 0};
+                case Type::ID::Error:   return {SortClass::Error,   (uint32_t)cell._Value.Int32};
+                case Type::ID::Empty:   return {SortClass::Empty,   0};
+                default:                return {SortClass::Error,   0};
+            }
+        }
+
+
+        //
+        // Stable LSD radix sort of (key, row) pairs by key, one byte per pass.
+        // All eight histograms are built in a single read, and passes in which
+        // every key has the same byte are skipped (e.g. the exponent bytes of
+        // numbers of similar magnitude).
+        //
+        inline void RadixSort(std::vector<uint64_t>& keys, std::vector<uint64_t>& rows)
+        {
+            const uint64_t count = keys.size();
+
+            if (count < 256)
+            {
+                std::vector<std::pair<uint64_t, uint64_t>> pairs(count);
+
+                for (uint64_t i = 0; i < count; i++)
+                    pairs[i] = {keys[i], rows[i]};
+
+                std::stable_sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+                for (uint64_t i = 0; i < count; i++)
+                    std::tie(keys[i], rows[i]) = pairs[i];
+
+                return;
+            }
+
+            std::vector<std::array<uint64_t, 256>> counts(8);
+
+            for (const auto key : keys)
+            {
+                for (uint64_t pass = 0; pass < 8; pass++)
+                    counts[pass][(key >> (8 * pass)) & 0xFF]++;
+            }
+
+            std::vector<uint64_t> keysOut(count);
+            std::vector<uint64_t> rowsOut(count);
+
+            for (uint64_t pass = 0; pass < 8; pass++)
+            {
+                const uint64_t shift = 8 * pass;
+                auto& histogram = counts[pass];
+
+                if (histogram[(keys[0] >> shift) & 0xFF] == count)
+                    continue;
+
+                uint64_t offset = 0;
+
+                for (auto& bucket : histogram)
+                    offset += std::exchange(bucket, offset);
+
+                for (uint64_t i = 0; i < count; i++)
+                {
+                    const uint64_t to = histogram[(keys[i] >> shift) & 0xFF]++;
+
+                    keysOut[to] = keys[i];
+                    rowsOut[to] = rows[i];
+                }
+
+                keys.swap(keysOut);
+                rows.swap(rowsOut);
+            }
+        }
+
+
+        //
+        // std::stable_sort, optionally split into one chunk per pool thread with
+        // the sorted chunks merged pairwise (merges of one level run in parallel).
+        //
+        template <typename _Ty, typename _Cmp>
+        inline void StableSort(std::vector<_Ty>& items, _Cmp comp, const bool parallel)
+        {
+            constexpr uint64_t minChunk = 4096;
+
+            const uint64_t count = items.size();
+            const uint64_t chunks = parallel ? std::min(ThreadPool::Instance().Concurrency(), count / minChunk) : 1;
+
+            if (chunks < 2)
+            {
+                std::stable_sort(items.begin(), items.end(), comp);
+                return;
+            }
+
+            std::vector<uint64_t> bounds(chunks + 1);
+
+            for (uint64_t c = 0; c <= chunks; c++)
+                bounds[c] = count * c / chunks;
+
+            ParallelFor(0, chunks, [&](uint64_t first, uint64_t last)
+            {
+                for (auto c = first; c < last; c++)
+                    std::stable_sort(items.begin() + bounds[c], items.begin() + bounds[c + 1], comp);
+            }, 1);
+
+            for (uint64_t width = 1; width < chunks; width *= 2)
+            {
+                ParallelFor(0, (chunks + 2 * width - 1) / (2 * width), [&](uint64_t first, uint64_t last)
+                {
+                    for (auto p = first; p < last; p++)
+                    {
+                        const uint64_t lo   = bounds[p * 2 * width];
+                        const uint64_t mid  = bounds[std::min(p * 2 * width + width, chunks)];
+                        const uint64_t hi   = bounds[std::min(p * 2 * width + 2 * width, chunks)];
+
+                        std::inplace_merge(items.begin() + lo, items.begin() + mid, items.begin() + hi, comp);
+                    }
+                }, 1);
+            }
+        }
+
+
+        //
+        // Stably reorders 'perm' by the cells column[perm[i]].
+        //
+        inline void SortBy(std::vector<uint64_t>& perm, StridedView<const Variant> column, const SortOrder order, const bool parallel)
+        {
+            const uint64_t count = perm.size();
+            const bool descending = order == SortOrder::Descending;
+
+            std::vector<SortCell> cells(count);
+
+            auto extract = [&](uint64_t first, uint64_t last)
+            {
+                for (auto i = first; i < last; i++)
+                    cells[i] = SortCell::Of(column[perm[i]]);
+            };
+
+            if (parallel)
+                ParallelFor(0, count, extract);
+            else
+                extract(0, count);
+
+            // Split into classes, keeping the current order inside each one
+
+            struct TextEntry
+            {
+                uint64_t        Prefix;
+                uint64_t        Row;
+                const String*   Str;
+            };
+
+            std::vector<uint64_t>   numberKeys;
+            std::vector<uint64_t>   numberRows;
+            std::vector<TextEntry>  text;
+            std::vector<uint64_t>   bools[2];
+            std::vector<uint64_t>   errors;
+            std::vector<uint64_t>   empties;
+
+            for (uint64_t i = 0; i < count; i++)
+            {
+                const auto row = perm[i];
+                const auto& cell = cells[i];
+
+                switch (cell.Class)
+                {
+                    case SortClass::Number:
+                        numberKeys.push_back(descending ? ~cell.Key : cell.Key);
+                        numberRows.push_back(row);
+                        break;
+
+                    case SortClass::Text:
+                        text.push_back({cell.Key, row, &static_cast<const String&>(column[row])});
+                        break;
+
+                    case SortClass::Bool:   bools[cell.Key].push_back(row); break;
+                    case SortClass::Error:  errors.push_back(row);          break;
+                    case SortClass::Empty:  empties.push_back(row);         break;
+                }
+            }
+
+            RadixSort(numberKeys, numberRows);
+
+            auto less = [](const TextEntry& lhs, const TextEntry& rhs)
+            {
+                if (lhs.Prefix != rhs.Prefix)
+                    return lhs.Prefix < rhs.Prefix;
+
+                return lhs.Str->Compare(*rhs.Str, CaseSensitivity::Insensitive) < 0;
+            };
+
+            if (descending)
+                StableSort(text, [&](const TextEntry& lhs, const TextEntry& rhs) { return less(rhs, lhs); }, parallel);
+            else
+                StableSort(text, less, parallel);
+
+            // Write the classes back in Excel's order; empties always go last
+
+            auto out = perm.begin();
+
+            auto writeNumbers   = [&] { out = std::copy(numberRows.begin(), numberRows.end(), out); };
+            auto writeText      = [&] { for (auto& entry : text) *out++ = entry.Row; };
+            auto writeBools     = [&] { out = std::copy(bools[descending].begin(), bools[descending].end(), out);
+                                        out = std::copy(bools[!descending].begin(), bools[!descending].end(), out); };
+            auto writeErrors    = [&] { out = std::copy(errors.begin(), errors.end(), out); };
+
+            if (descending)
+            {
+                writeErrors();
+                writeBools();
+                writeText();
+                writeNumbers();
+            }
+            else
+            {
+                writeNumbers();
+                writeText();
+                writeBools();
+                writeErrors();
+            }
+
+            std::copy(empties.begin(), empties.end(), out);
+        }
+
+
+        template <Numeric _Ty>
+        inline void SortBy(std::vector<uint64_t>& perm, StridedView<_Ty> column, const SortOrder order, const bool parallel)
+        {
+            const uint64_t count = perm.size();
+            const bool descending = order == SortOrder::Descending;
+
+            std::vector<uint64_t> keys(count);
+
+            auto extract = [&](uint64_t first, uint64_t last)
+            {
+                for (auto i = first; i < last; i++)
+                {
+                    const auto key = OrderedBits(column[perm[i]]);
+                    keys[i] = descending ? ~key : key;
+                }
+            };
+
+            if (parallel)
+                ParallelFor(0, count, extract);
+            else
+                extract(0, count);
+
+            RadixSort(keys, perm);
+        }
+    }
+
+
+    inline std::vector<uint64_t> SortPermutation(StridedView<const Variant> column, const SortOrder order, const bool parallel)
+    {
+        std::vector<uint64_t> perm(column.Size());
+        std::iota(perm.begin(), perm.end(), 0);
+
+        Detail::SortBy(perm, column, order, parallel);
+
+        return perm;
+    }
+
+
+    template <Numeric _Ty>
+    inline std::vector<uint64_t> SortPermutation(StridedView<_Ty> column, const SortOrder order, const bool parallel)
+    {
+        std::vector<uint64_t> perm(column.Size());
+        std::iota(perm.begin(), perm.end(), 0);
+
+        Detail::SortBy(perm, column, order, parallel);
+
+        return perm;
+    }
+
+
+    //
+    // Sorts by the last key first; since every pass is stable, earlier keys end
+    // up taking precedence.
+    //
+    template <ArrayValue _Ty>
+    inline std::vector<uint64_t> SortPermutation(const Array<_Ty>& array, const std::vector<SortKey>& keys, const bool parallel)
+    {
+        for (auto& key : keys)
+        {
+            if (key.Column >= array.Columns())
+                MXL_THROW("Sort column out of range");
+        }
+
+        std::vector<uint64_t> perm(array.Rows());
+        std::iota(perm.begin(), perm.end(), 0);
+
+        for (auto key = keys.rbegin(); key != keys.rend(); key++)
+            Detail::SortBy(perm, array.ColumnView(key->Column), key->Order, parallel);
+
+        return perm;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline Array<_Ty> Permute(const Array<_Ty>& array, const std::vector<uint64_t>& rows)
+    {
+        for (auto row : rows)
+        {
+            if (row >= array.Rows())
+                MXL_THROW("Row index out of range");
+        }
+
+        Array<_Ty> result(rows.size(), array.Columns());
+
+        for (uint64_t col = 0; col < array.Columns(); col++)
+        {
+            for (uint64_t i = 0; i < rows.size(); i++)
+                result(i, col) = array(rows[i], col);
+        }
+
+        return result;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline Array<_Ty> Sort(const Array<_Ty>& array, const std::vector<SortKey>& keys, const bool parallel)
+    {
+        return Permute(array, SortPermutation(array, keys, parallel));
+    }
+}
\ No newline at end of file
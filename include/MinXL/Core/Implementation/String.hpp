@@ -2,20 +2,136 @@
 
 #include "MinXL/Core/Types.hpp"
 
+#include "MinXL/Core/Interface/Arena.hpp"
 #include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
+#include "MinXL/Core/Interface/Unicode.hpp"
 #include "MinXL/Core/Interface/Variant.hpp"
 
 
 namespace mxl
 {
+    namespace Detail
+    {
+        //
+        // Index of the first position where 'lhs' and 'rhs' differ, or 'length'
+        // when the first 'length' units are identical. Compares 8 units at a time.
+        //
+        inline uint64_t Mismatch(const char16_t* lhs, const char16_t* rhs, const uint64_t length)
+        {
+            uint64_t i = 0;
+
+#if defined(__SSE2__)
+            for (; i + 8 <= length; i += 8)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+                const unsigned equal = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi16(a, b));
+
+                if (equal != 0xFFFF)
+                    return i + std::countr_zero(~equal) / 2;
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            for (; i + 8 <= length; i += 8)
+            {
+                const uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t*>(lhs + i));
+                const uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t*>(rhs + i));
+
+                if (vminvq_u16(vceqq_u16(a, b)) == 0)
+                    break;
+            }
+#endif
+
+            for (; i < length && lhs[i] == rhs[i]; i++);
+
+            return i;
+        }
+
+
+        //
+        // Simple lowercase mapping for the Latin-1, Latin Extended-A, Greek and
+        // Cyrillic blocks. Other characters are returned unchanged.
+        //
+        inline char16_t FoldCase(const char16_t c)
+        {
+            if (c < 0x80)
+                return (c >= u'A' && c <= u'Z') ? c + 32 : c;
+
+            if (c >= 0xC0 && c <= 0xDE && c != 0xD7)
+                return c + 32;
+
+            // Latin Extended-A alternates upper/lower case pairs
+            if ((c >= 0x100 && c <= 0x12F) || (c >= 0x132 && c <= 0x137) || (c >= 0x14A && c <= 0x177))
+                return c | 1;
+
+            if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E))
+                return (c & 1) ? c + 1 : c;
+
+            if (c == 0x130)
+                return u'i';
+
+            if (c == 0x178)
+                return 0xFF;
+
+            if (c >= 0x391 && c <= 0x3AB && c != 0x3A2)
+                return c + 32;
+
+            if (c >= 0x410 && c <= 0x42F)
+                return c + 32;
+
+            if (c >= 0x400 && c <= 0x40F)
+                return c + 80;
+
+            return c;
+        }
+
+
+        //
+        // Bytes allocated for a string of 'length' units (header, units and
+        // terminator), always a multiple of 16.
+        //
+        constexpr uint64_t StringAllocationSize(const uint64_t length)
+        {
+            const uint64_t size = sizeof(StringHeader) + (length + 1) * sizeof(char16_t);
+            return (size + 15) & ~uint64_t{15};
+        }
+
+
+        inline constexpr uint64_t HashSeed = 0x9E3779B97F4A7C15;
+
+        inline uint64_t HashStep(const uint64_t hash, const uint64_t word)
+        {
+            return std::rotl(hash ^ (word * 0x87C37B91114253D5), 31) * 0x4CF5AD432745937F;
+        }
+
+        inline uint64_t HashFinal(uint64_t hash)
+        {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCD;
+            hash ^= hash >> 33;
+            hash *= 0xC4CEB9FE1A85EC53;
+            hash ^= hash >> 33;
+
+            return hash;
+        }
+    }
+
+
     inline String::String(): _Buffer{nullptr}
     {
     }
 
 
-    inline String::String(const char16_t* str)
+    inline String::String(const char16_t* str): _Buffer{nullptr}
+    {
+        if (str)
+            Allocate(str, std::char_traits<char16_t>::length(str));
+    }
+
+
+    inline String::String(const char16_t* str, const uint64_t length)
     {
-        Allocate(str);
+        Allocate(str, length);
     }
 
 
@@ -24,18 +140,37 @@ namespace mxl
     }
 
 
-    inline String::String(const char* str): String(Char8to16(str).get())
+    inline String::String(const char* str): String(std::string_view{str})
     {
     }
 
 
-    inline String::String(const String& other): String(other.Buffer())
+    //
+    // Decodes UTF-8 straight into the new buffer. Malformed sequences become
+    // U+FFFD.
+    //
+    inline String::String(std::string_view utf8)
     {
+        Allocate(Unicode::Utf16Length(utf8.data(), utf8.size()));
+        Unicode::ToUtf16(utf8.data(), utf8.size(), _Buffer);
+    }
+
+
+    inline String::String(const String& other MXL_CALLER_PARAM_IMPL): _Buffer{nullptr}
+    {
+        MXL_TRACE_CALLER(caller);
+
+        if (other.Buffer())
+            Allocate(other.Buffer(), other.Size());
+
+        MXL_TRACE(DeepCopy, Size() * sizeof(char16_t));
     }
 
 
     inline String::String(String&& other): _Buffer{other._Buffer}
     {
+        MXL_TRACE(Move, Size() * sizeof(char16_t));
+
         std::memset(&other, 0, sizeof(String));
     }
 
@@ -46,8 +181,13 @@ namespace mxl
             return *this;
 
         Deallocate(Buffer());
-        Allocate(other.Buffer());
-        
+        _Buffer = nullptr;
+
+        if (other.Buffer())
+            Allocate(other.Buffer(), other.Size());
+
+        MXL_TRACE(DeepCopy, Size() * sizeof(char16_t));
+
         return *this;
     }
 
@@ -59,6 +199,8 @@ namespace mxl
 
         Deallocate(Buffer());
 
+        MXL_TRACE(Move, other.Size() * sizeof(char16_t));
+
         std::memcpy(this, &other, sizeof(String));
         std::memset(&other, 0, sizeof(String));
         
@@ -84,153 +226,197 @@ namespace mxl
 
     inline bool String::operator==(const String& other) const
     {
-        return Compare(Buffer(), other.Buffer());
+        return Equals(other);
     }
 
 
     inline bool String::operator!=(const String& other) const
     {
-        return !Compare(Buffer(), other.Buffer());
+        return !Equals(other);
     }
 
 
-    inline uint64_t String::Size() const
+    inline std::strong_ordering String::operator<=>(const String& other) const
     {
-        return _Buffer ? Container()->Header.Size : 0;
+        const uint64_t common = std::min(Size(), other.Size());
+        const uint64_t index = Detail::Mismatch(Buffer(), other.Buffer(), common);
+
+        if (index < common)
+            return Buffer()[index] <=> other.Buffer()[index];
+
+        return Size() <=> other.Size();
     }
 
 
-    inline char16_t* String::Buffer() const
+    //
+    // Shared prefixes are skipped with the vectorized exact compare; case
+    // folding only starts at the first unit that differs.
+    //
+    inline std::weak_ordering String::Compare(const String& other, const CaseSensitivity sensitivity) const
     {
-        return _Buffer;
+        if (sensitivity == CaseSensitivity::Sensitive)
+            return operator<=>(other);
+
+        const uint64_t common = std::min(Size(), other.Size());
+
+        for (uint64_t i = Detail::Mismatch(Buffer(), other.Buffer(), common); i < common; i++)
+        {
+            const char16_t lhs = Detail::FoldCase(Buffer()[i]);
+            const char16_t rhs = Detail::FoldCase(other.Buffer()[i]);
+
+            if (lhs != rhs)
+                return lhs <=> rhs;
+        }
+
+        return Size() <=> other.Size();
     }
 
 
-    inline std::unique_ptr<char[]> String::CStr() const
+    inline bool String::Equals(const String& other, const CaseSensitivity sensitivity) const
     {
-        return Char16to8(Buffer());
+        // Sizes are stored in the header, so most unequal strings stop here
+        if (Size() != other.Size())
+            return false;
+
+        if (Buffer() == other.Buffer())
+            return true;
+
+        if (sensitivity == CaseSensitivity::Sensitive)
+            return Detail::Mismatch(Buffer(), other.Buffer(), Size()) == Size();
+
+        return Compare(other, sensitivity) == 0;
     }
 
 
-    inline StringContainer* String::Container() const
+    inline uint64_t String::Hash(const CaseSensitivity sensitivity) const
     {
-        return reinterpret_cast<StringContainer*>(
-            (std::byte*)_Buffer - sizeof(StringHeader)
-        );
-    }
+        const uint64_t length = Size();
 
+        uint64_t hash = Detail::HashSeed ^ length;
+        uint64_t i = 0;
 
-    inline void String::Allocate(const char16_t* str)
-    {   
-        if (!str)
+        if (sensitivity == CaseSensitivity::Sensitive)
         {
-            _Buffer = nullptr;
+            // Four code units per step
+            for (; i + 4 <= length; i += 4)
+            {
+                uint64_t word;
+                std::memcpy(&word, Buffer() + i, sizeof(word));
+                hash = Detail::HashStep(hash, word);
+            }
+
+            if (i < length)
+            {
+                uint64_t word = 0;
+                std::memcpy(&word, Buffer() + i, (length - i) * sizeof(char16_t));
+                hash = Detail::HashStep(hash, word);
+            }
         }
         else
         {
-            const char16_t* end = str;
-            
-            // Count characters, including null-termination
-            while (*end++);
-
-            const uint64_t length = end - str;
-
-            uint64_t allocSize = sizeof(StringHeader) + length * sizeof(char16_t);
+            for (; i < length; i += 4)
+            {
+                uint64_t word = 0;
 
-            // Always allocate in blocks of 16 bytes
-            if (allocSize % 16 > 0)
-                allocSize += (16 - allocSize % 16);
+                for (uint64_t k = 0; k < 4 && i + k < length; k++)
+                    word |= (uint64_t)Detail::FoldCase(Buffer()[i + k]) << (16 * k);
 
-            if (auto container = static_cast<StringContainer*>(std::malloc(allocSize)))
-            {
-                container->Header.Size = (length - 1);
-                std::copy(str, str + length, container->Buffer);
-                
-                _Buffer = container->Buffer;
-            }
-            else
-            {
-                MXL_THROW("Dynamic allocation failed.");
+                hash = Detail::HashStep(hash, word);
             }
         }
+
+        return Detail::HashFinal(hash);
     }
 
 
-    inline void String::Deallocate(char16_t* str)
+    inline uint64_t String::Size() const
     {
-        if (str)
-            std::free((std::byte*)str - sizeof(StringHeader));
+        return _Buffer ? Container()->Header.Size : 0;
     }
 
 
-    inline bool String::Compare(const char16_t* lhs, const char16_t* rhs)
+    inline char16_t* String::Buffer() const
     {
-        if (lhs == nullptr && rhs == nullptr)
-            return true;
-        else if (lhs == nullptr || rhs == nullptr)
-            return false;
-        
-        while(*lhs && *rhs)
-        {
-            if (*lhs != *rhs)
-            {
-                return false;
-            }
-            else
-            {
-                lhs++;
-                rhs++;
-                continue;
-            }
-        }
-
-        if (*lhs == *rhs)
-            return true;
-        
-        else
-            return false;
+        return _Buffer;
     }
 
 
-    inline std::unique_ptr<char[]> String::Char16to8(const char16_t* str)
+    inline std::unique_ptr<char[]> String::CStr() const
     {
-        if (!(*str))
-            return std::unique_ptr<char[]>(new char[1]{'\0'});
+        return Char16to8(Buffer(), Size());
+    }
 
-        const char16_t* end = str;
 
-        while (*end++);
+    inline std::string String::Utf8() const
+    {
+        std::string result(Unicode::Utf8Length(Buffer(), Size()), '\0');
+        Unicode::ToUtf8(Buffer(), Size(), result.data());
 
-        int n = end - str;
-        auto converted = std::unique_ptr<char[]>(new char[n]{'\0'});
+        return result;
+    }
 
-        for (int c = 0; c < n - 1; c++)
-            converted[c] = (char)(str[c]);
 
-        return converted;
+    inline StringContainer* String::Container() const
+    {
+        return reinterpret_cast<StringContainer*>(
+            (std::byte*)_Buffer - sizeof(StringHeader)
+        );
     }
 
 
-    inline std::unique_ptr<char16_t[]> String::Char8to16(const char* str)
+    //
+    // Allocates room for 'length' characters plus the null-terminator and sets
+    // the size. The characters themselves are left for the caller to fill in.
+    //
+    inline void String::Allocate(const uint64_t length)
     {
-        if (!(*str))
+        const uint64_t allocSize = Detail::StringAllocationSize(length);
+
+        if (auto container = static_cast<StringContainer*>(Detail::Malloc(allocSize)))
         {
-            return std::unique_ptr<char16_t[]>(new char16_t[1]{'\0'});
+            MXL_TRACE(Allocate, allocSize);
+
+            container->Header.Size = (uint32_t)length;
+            container->Buffer[length] = u'\0';
+
+            _Buffer = container->Buffer;
         }
+        else
+        {
+            MXL_THROW("Dynamic allocation failed.");
+        }
+    }
 
-        const char* end = str;
 
-        while (*end++);
+    inline void String::Allocate(const char16_t* str, const uint64_t length)
+    {
+        Allocate(length);
+        std::copy(str, str + length, _Buffer);
+    }
 
-        int n = end - str;
-        auto converted = std::unique_ptr<char16_t[]>(new char16_t[n]{'\0'});
 
-        for (int c = 0; c < n - 1; c++)
-            converted[c] = (char16_t)(str[c]);
+    inline void String::Deallocate(char16_t* str)
+    {
+        if (str)
+        {
+            MXL_TRACE(Deallocate, Detail::StringAllocationSize(reinterpret_cast<StringContainer*>((std::byte*)str - sizeof(StringHeader))->Header.Size));
+            Detail::Free((std::byte*)str - sizeof(StringHeader));
+        }
+    }
+
+
+    inline std::unique_ptr<char[]> String::Char16to8(const char16_t* str, const uint64_t length)
+    {
+        const uint64_t bytes = Unicode::Utf8Length(str, length);
+
+        auto converted = std::unique_ptr<char[]>(new char[bytes + 1]);
+        Unicode::ToUtf8(str, length, converted.get());
+        converted[bytes] = '\0';
 
         return converted;
     }
 
+
     inline std::ostream& operator<<(std::ostream &os, const String& str)
     {
         return os << str.CStr();
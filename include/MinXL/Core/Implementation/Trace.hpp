@@ -0,0 +1,364 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Trace.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        struct TraceState
+        {
+            std::atomic<uint64_t>   Allocations{0};
+            std::atomic<uint64_t>   Deallocations{0};
+            std::atomic<uint64_t>   DeepCopies{0};
+            std::atomic<uint64_t>   Moves{0};
+            std::atomic<uint64_t>   BytesAllocated{0};
+            std::atomic<uint64_t>   BytesFreed{0};
+            std::atomic<uint64_t>   BytesCopied{0};
+            std::atomic<uint64_t>   BytesMoved{0};
+            std::atomic<int64_t>    LiveBytes{0};
+            std::atomic<int64_t>    PeakBytes{0};
+
+            std::atomic<std::FILE*> Log{nullptr};
+            std::atomic<uint64_t>   LargeCopy{1 << 20};
+
+            std::mutex                                  Lock;       // Guards the summaries and log output
+            std::map<std::string, Trace::ScopeSummary>  Summaries;
+        };
+
+
+        inline TraceState& TraceGlobal()
+        {
+            static TraceState state;
+            return state;
+        }
+
+
+        inline thread_local Trace::Counters             TraceTotals{};
+        inline thread_local Trace::Scope*               TraceScope = nullptr;
+        inline thread_local const std::source_location* TraceCaller = nullptr;
+
+
+        // Whether 'file' is one of MinXL's own headers
+        inline bool TraceIsLibrary(const char* file)
+        {
+            return std::strstr(file, "MinXL/Core/") || std::strstr(file, "MinXL\\Core\\");
+        }
+
+
+        inline const char* TraceFormatSite(const std::source_location& where, char* buffer, const uint64_t size)
+        {
+            const char* file = where.file_name();
+
+            for (const char* c = file; *c; c++)
+            {
+                if (*c == '/' || *c == '\\')
+                    file = c + 1;
+            }
+
+            std::snprintf(buffer, size, "%s, line %u", file, (unsigned)where.line());
+            return buffer;
+        }
+
+
+        inline Trace::Counters TraceDifference(const Trace::Counters& now, const Trace::Counters& start)
+        {
+            return Trace::Counters{
+                now.Allocations     - start.Allocations,
+                now.Deallocations   - start.Deallocations,
+                now.DeepCopies      - start.DeepCopies,
+                now.Moves           - start.Moves,
+                now.BytesAllocated  - start.BytesAllocated,
+                now.BytesFreed      - start.BytesFreed,
+                now.BytesCopied     - start.BytesCopied,
+                now.BytesMoved      - start.BytesMoved,
+                now.LiveBytes       - start.LiveBytes,
+                now.PeakBytes       - start.LiveBytes
+            };
+        }
+
+
+        inline const char* TraceEventName(const Trace::Event event)
+        {
+            switch (event)
+            {
+                case Trace::Event::Allocate:   return "Allocate";
+                case Trace::Event::Deallocate: return "Deallocate";
+                case Trace::Event::DeepCopy:   return "DeepCopy";
+                case Trace::Event::Move:       return "Move";
+            }
+
+            return "";
+        }
+    }
+
+
+    namespace Trace
+    {
+        inline Scope::Scope(const char* name, const std::source_location where)
+            : _Name{name}, _Where{where}, _Parent{Detail::TraceScope}, _Start{Detail::TraceTotals}, _SavedPeak{Detail::TraceTotals.PeakBytes}
+        {
+            // The high-water mark restarts from what is live right now
+            Detail::TraceTotals.PeakBytes = Detail::TraceTotals.LiveBytes;
+            Detail::TraceScope = this;
+        }
+
+
+        inline Scope::~Scope()
+        {
+            auto& totals = Detail::TraceTotals;
+            const auto delta = Current();
+
+            totals.PeakBytes = std::max(_SavedPeak, totals.PeakBytes);
+            Detail::TraceScope = _Parent;
+
+            auto& global = Detail::TraceGlobal();
+            std::lock_guard lock{global.Lock};
+
+            auto& summary = global.Summaries[_Name];
+
+            if (summary.Calls == 0)
+            {
+                summary.Name = _Name;
+                summary.Totals = delta;
+            }
+            else
+            {
+                auto& sum = summary.Totals;
+
+                sum.Allocations     += delta.Allocations;
+                sum.Deallocations   += delta.Deallocations;
+                sum.DeepCopies      += delta.DeepCopies;
+                sum.Moves           += delta.Moves;
+                sum.BytesAllocated  += delta.BytesAllocated;
+                sum.BytesFreed      += delta.BytesFreed;
+                sum.BytesCopied     += delta.BytesCopied;
+                sum.BytesMoved      += delta.BytesMoved;
+                sum.LiveBytes       += delta.LiveBytes;
+                sum.PeakBytes       = std::max(sum.PeakBytes, delta.PeakBytes);
+            }
+
+            summary.Calls++;
+
+            if (auto log = global.Log.load(std::memory_order_relaxed))
+            {
+                std::fprintf(log,
+                    "[MinXL] Trace: scope %s: %" PRIu64 " allocations (%" PRIu64 " bytes), %" PRIu64 " deep copies (%" PRIu64 " bytes), %" PRIu64 " moves, peak %" PRId64 " bytes\n",
+                    _Name, delta.Allocations, delta.BytesAllocated, delta.DeepCopies, delta.BytesCopied, delta.Moves, delta.PeakBytes);
+            }
+        }
+
+
+        inline Counters Scope::Current() const
+        {
+            return Detail::TraceDifference(Detail::TraceTotals, _Start);
+        }
+
+
+        inline const Scope* Scope::Active()
+        {
+            return Detail::TraceScope;
+        }
+
+
+        inline CallSite::CallSite(const std::source_location& where)
+            : _Active{!Detail::TraceCaller && !Detail::TraceIsLibrary(where.file_name())}
+        {
+            if (_Active)
+                Detail::TraceCaller = &where;
+        }
+
+
+        inline CallSite::~CallSite()
+        {
+            if (_Active)
+                Detail::TraceCaller = nullptr;
+        }
+
+
+        inline void Record(const Event event, const uint64_t bytes, const char* where)
+        {
+            // Scalars and empty containers are moved on every assignment; only
+            // moves that hand over a buffer are worth counting
+            if (event == Event::Move && bytes == 0)
+                return;
+
+            auto& totals = Detail::TraceTotals;
+            auto& global = Detail::TraceGlobal();
+
+            switch (event)
+            {
+                case Event::Allocate:
+                {
+                    totals.Allocations++;
+                    totals.BytesAllocated += bytes;
+                    totals.LiveBytes += (int64_t)bytes;
+                    totals.PeakBytes = std::max(totals.PeakBytes, totals.LiveBytes);
+
+                    global.Allocations.fetch_add(1, std::memory_order_relaxed);
+                    global.BytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+                    const int64_t live = global.LiveBytes.fetch_add((int64_t)bytes, std::memory_order_relaxed) + (int64_t)bytes;
+                    int64_t peak = global.PeakBytes.load(std::memory_order_relaxed);
+
+                    while (live > peak && !global.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+
+                    break;
+                }
+
+                case Event::Deallocate:
+                {
+                    totals.Deallocations++;
+                    totals.BytesFreed += bytes;
+                    totals.LiveBytes -= (int64_t)bytes;
+
+                    global.Deallocations.fetch_add(1, std::memory_order_relaxed);
+                    global.BytesFreed.fetch_add(bytes, std::memory_order_relaxed);
+                    global.LiveBytes.fetch_sub((int64_t)bytes, std::memory_order_relaxed);
+                    break;
+                }
+
+                case Event::DeepCopy:
+                {
+                    totals.DeepCopies++;
+                    totals.BytesCopied += bytes;
+
+                    global.DeepCopies.fetch_add(1, std::memory_order_relaxed);
+                    global.BytesCopied.fetch_add(bytes, std::memory_order_relaxed);
+                    break;
+                }
+
+                case Event::Move:
+                {
+                    totals.Moves++;
+                    totals.BytesMoved += bytes;
+
+                    global.Moves.fetch_add(1, std::memory_order_relaxed);
+                    global.BytesMoved.fetch_add(bytes, std::memory_order_relaxed);
+                    break;
+                }
+            }
+
+            const uint64_t largeCopy = global.LargeCopy.load(std::memory_order_relaxed);
+            const bool large = event == Event::DeepCopy && largeCopy && bytes >= largeCopy;
+
+            std::FILE* log = global.Log.load(std::memory_order_relaxed);
+
+            if (!large && !log)
+                return;
+
+            if (!log)
+                log = stderr;
+
+            std::lock_guard lock{global.Lock};
+
+            const char* scope = Detail::TraceScope ? Detail::TraceScope->Name() : "-";
+
+            // Point at user code when we know it
+            char site[512];
+
+            if (Detail::TraceCaller)
+                where = Detail::TraceFormatSite(*Detail::TraceCaller, site, sizeof(site));
+            else if (Detail::TraceScope)
+                where = Detail::TraceFormatSite(Detail::TraceScope->Where(), site, sizeof(site));
+
+            std::fprintf(log, "[MinXL] Trace: %s%s %" PRIu64 " bytes at %s (scope %s)\n",
+                large ? "large " : "", Detail::TraceEventName(event), bytes, where, scope);
+        }
+
+
+        inline Counters ThreadCounters()
+        {
+            return Detail::TraceTotals;
+        }
+
+
+        inline Counters GlobalCounters()
+        {
+            auto& global = Detail::TraceGlobal();
+
+            return Counters{
+                global.Allocations.load(std::memory_order_relaxed),
+                global.Deallocations.load(std::memory_order_relaxed),
+                global.DeepCopies.load(std::memory_order_relaxed),
+                global.Moves.load(std::memory_order_relaxed),
+                global.BytesAllocated.load(std::memory_order_relaxed),
+                global.BytesFreed.load(std::memory_order_relaxed),
+                global.BytesCopied.load(std::memory_order_relaxed),
+                global.BytesMoved.load(std::memory_order_relaxed),
+                global.LiveBytes.load(std::memory_order_relaxed),
+                global.PeakBytes.load(std::memory_order_relaxed)
+            };
+        }
+
+
+        inline std::vector<ScopeSummary> Summaries()
+        {
+            auto& global = Detail::TraceGlobal();
+            std::lock_guard lock{global.Lock};
+
+            std::vector<ScopeSummary> summaries;
+
+            for (auto& [name, summary] : global.Summaries)
+                summaries.push_back(summary);
+
+            return summaries;
+        }
+
+
+        inline void Reset()
+        {
+            auto& global = Detail::TraceGlobal();
+
+            for (auto counter : {&global.Allocations, &global.Deallocations, &global.DeepCopies, &global.Moves,
+                                 &global.BytesAllocated, &global.BytesFreed, &global.BytesCopied, &global.BytesMoved})
+                counter->store(0, std::memory_order_relaxed);
+
+            global.LiveBytes.store(0, std::memory_order_relaxed);
+            global.PeakBytes.store(0, std::memory_order_relaxed);
+
+            std::lock_guard lock{global.Lock};
+            global.Summaries.clear();
+        }
+
+
+        inline void SetLog(std::FILE* file)
+        {
+            Detail::TraceGlobal().Log.store(file, std::memory_order_relaxed);
+        }
+
+
+        inline void SetLargeCopyThreshold(const uint64_t bytes)
+        {
+            Detail::TraceGlobal().LargeCopy.store(bytes, std::memory_order_relaxed);
+        }
+
+
+        inline void Report(std::ostream& os)
+        {
+            auto row = [&os](const std::string& name, const uint64_t calls, const Counters& counters)
+            {
+                char line[256];
+
+                std::snprintf(line, sizeof(line), "%-24s %8" PRIu64 " %10" PRIu64 " %14" PRIu64 " %10" PRIu64 " %14" PRIu64 " %10" PRIu64 " %14" PRId64 "\n",
+                    name.c_str(), calls, counters.Allocations, counters.BytesAllocated, counters.DeepCopies, counters.BytesCopied, counters.Moves, counters.PeakBytes);
+
+                os << line;
+            };
+
+            char header[256];
+
+            std::snprintf(header, sizeof(header), "%-24s %8s %10s %14s %10s %14s %10s %14s\n",
+                "Scope", "Calls", "Allocs", "Bytes", "Copies", "Bytes", "Moves", "Peak bytes");
+
+            os << header;
+            row("(global)", 0, GlobalCounters());
+
+            for (auto& summary : Summaries())
+                row(summary.Name, summary.Calls, summary.Totals);
+        }
+    }
+}
\ No newline at end of file
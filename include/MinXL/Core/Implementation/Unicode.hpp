@@ -0,0 +1,354 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Unicode.hpp"
+#include "MinXL/Core/Interface/Variant.hpp"
+#include "MinXL/Core/Interface/View.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        inline constexpr char32_t Replacement = 0xFFFD;
+
+        inline bool IsHighSurrogate(const char32_t c)   { return c >= 0xD800 && c <= 0xDBFF; }
+        inline bool IsLowSurrogate(const char32_t c)    { return c >= 0xDC00 && c <= 0xDFFF; }
+
+
+        //
+        // Length of the leading all-ASCII run of a UTF-16 buffer, checked 16 units
+        // at a time. When 'out' is not null the run is also narrowed into it.
+        //
+        inline uint64_t AsciiRun16(const char16_t* str, const uint64_t length, char* out)
+        {
+            uint64_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128i high = _mm_set1_epi16((short)0xFF80);
+            const __m128i zero = _mm_setzero_si128();
+
+            for (; i + 16 <= length; i += 16)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + 8));
+                const __m128i any = _mm_and_si128(_mm_or_si128(a, b), high);
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(any, zero)) != 0xFFFF)
+                    break;
+
+                if (out)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            for (; i + 16 <= length; i += 16)
+            {
+                const uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t*>(str + i));
+                const uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t*>(str + i + 8));
+
+                if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80)
+                    break;
+
+                if (out)
+                    vst1q_u8(reinterpret_cast<uint8_t*>(out + i), vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+            }
+#endif
+
+            for (; i < length && str[i] < 0x80; i++)
+            {
+                if (out)
+                    out[i] = (char)str[i];
+            }
+
+            return i;
+        }
+
+
+        //
+        // Length of the leading all-ASCII run of a UTF-8 buffer, checked 16 bytes
+        // at a time. When 'out' is not null the run is also widened into it.
+        //
+        inline uint64_t AsciiRun8(const char* str, const uint64_t length, char16_t* out)
+        {
+            uint64_t i = 0;
+
+#if defined(__SSE2__)
+            const __m128i zero = _mm_setzero_si128();
+
+            for (; i + 16 <= length; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+
+                if (_mm_movemask_epi8(bytes) != 0)
+                    break;
+
+                if (out)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),     _mm_unpacklo_epi8(bytes, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(bytes, zero));
+                }
+            }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+            for (; i + 16 <= length; i += 16)
+            {
+                const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(str + i));
+
+                if (vmaxvq_u8(bytes) >= 0x80)
+                    break;
+
+                if (out)
+                {
+                    vst1q_u16(reinterpret_cast<uint16_t*>(out + i),     vmovl_u8(vget_low_u8(bytes)));
+                    vst1q_u16(reinterpret_cast<uint16_t*>(out + i + 8), vmovl_u8(vget_high_u8(bytes)));
+                }
+            }
+#endif
+
+            for (; i < length && (uint8_t)str[i] < 0x80; i++)
+            {
+                if (out)
+                    out[i] = (char16_t)str[i];
+            }
+
+            return i;
+        }
+
+
+        //
+        // Decodes one code point starting at str[i] (which is not ASCII) and returns
+        // the number of bytes consumed. Invalid sequences yield U+FFFD and consume
+        // their maximal valid prefix (at least one byte), as the Unicode standard
+        // recommends.
+        //
+        inline uint64_t DecodeUtf8(const uint8_t* str, const uint64_t i, const uint64_t length, char32_t& cp)
+        {
+            const uint8_t lead = str[i];
+
+            uint64_t    need;
+            uint8_t     low     = 0x80;
+            uint8_t     high    = 0xBF;
+
+            if (lead >= 0xC2 && lead <= 0xDF)       { need = 1; cp = lead & 0x1F; }
+            else if (lead >= 0xE0 && lead <= 0xEF)  { need = 2; cp = lead & 0x0F; low = lead == 0xE0 ? 0xA0 : 0x80; high = lead == 0xED ? 0x9F : 0xBF; }
+            else if (lead >= 0xF0 && lead <= 0xF4)  { need = 3; cp = lead & 0x07; low = lead == 0xF0 ? 0x90 : 0x80; high = lead == 0xF4 ? 0x8F : 0xBF; }
+            else
+            {
+                cp = Replacement;
+                return 1;
+            }
+
+            for (uint64_t k = 1; k <= need; k++)
+            {
+                // Only the first continuation byte has a narrowed range
+                const uint8_t lo = k == 1 ? low  : 0x80;
+                const uint8_t hi = k == 1 ? high : 0xBF;
+
+                if (i + k >= length || str[i + k] < lo || str[i + k] > hi)
+                {
+                    cp = Replacement;
+                    return k;
+                }
+
+                cp = (cp << 6) | (str[i + k] & 0x3F);
+            }
+
+            return need + 1;
+        }
+    }
+
+
+    namespace Unicode
+    {
+        inline uint64_t Utf8Length(const char16_t* str, const uint64_t length)
+        {
+            uint64_t bytes = 0;
+            uint64_t i = 0;
+
+            while (i < length)
+            {
+                const auto run = mxl::Detail::AsciiRun16(str + i, length - i, nullptr);
+
+                bytes   += run;
+                i       += run;
+
+                if (i == length)
+                    break;
+
+                const char32_t c = str[i];
+
+                if (c < 0x800)
+                {
+                    bytes += 2;
+                    i += 1;
+                }
+                else if (mxl::Detail::IsHighSurrogate(c) && i + 1 < length && mxl::Detail::IsLowSurrogate(str[i + 1]))
+                {
+                    bytes += 4;
+                    i += 2;
+                }
+                else
+                {
+                    // BMP character or lone surrogate (encoded as U+FFFD)
+                    bytes += 3;
+                    i += 1;
+                }
+            }
+
+            return bytes;
+        }
+
+
+        inline uint64_t Utf16Length(const char* str, const uint64_t length)
+        {
+            auto bytes = reinterpret_cast<const uint8_t*>(str);
+
+            uint64_t units = 0;
+            uint64_t i = 0;
+
+            while (i < length)
+            {
+                const auto run = mxl::Detail::AsciiRun8(str + i, length - i, nullptr);
+
+                units   += run;
+                i       += run;
+
+                if (i == length)
+                    break;
+
+                char32_t cp;
+                i       += mxl::Detail::DecodeUtf8(bytes, i, length, cp);
+                units   += cp >= 0x10000 ? 2 : 1;
+            }
+
+            return units;
+        }
+
+
+        inline uint64_t ToUtf8(const char16_t* str, const uint64_t length, char* out)
+        {
+            uint64_t o = 0;
+            uint64_t i = 0;
+
+            while (i < length)
+            {
+                const auto run = mxl::Detail::AsciiRun16(str + i, length - i, out + o);
+
+                o += run;
+                i += run;
+
+                if (i == length)
+                    break;
+
+                char32_t cp = str[i++];
+
+                if (mxl::Detail::IsHighSurrogate(cp) && i < length && mxl::Detail::IsLowSurrogate(str[i]))
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (str[i++] - 0xDC00);
+                else if (mxl::Detail::IsHighSurrogate(cp) || mxl::Detail::IsLowSurrogate(cp))
+                    cp = mxl::Detail::Replacement;
+
+                if (cp < 0x800)
+                {
+                    out[o++] = (char)(0xC0 | (cp >> 6));
+                    out[o++] = (char)(0x80 | (cp & 0x3F));
+                }
+                else if (cp < 0x10000)
+                {
+                    out[o++] = (char)(0xE0 | (cp >> 12));
+                    out[o++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                    out[o++] = (char)(0x80 | (cp & 0x3F));
+                }
+                else
+                {
+                    out[o++] = (char)(0xF0 | (cp >> 18));
+                    out[o++] = (char)(0x80 | ((cp >> 12) & 0x3F));
+                    out[o++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                    out[o++] = (char)(0x80 | (cp & 0x3F));
+                }
+            }
+
+            return o;
+        }
+
+
+        inline uint64_t ToUtf16(const char* str, const uint64_t length, char16_t* out)
+        {
+            auto bytes = reinterpret_cast<const uint8_t*>(str);
+
+            uint64_t o = 0;
+            uint64_t i = 0;
+
+            while (i < length)
+            {
+                const auto run = mxl::Detail::AsciiRun8(str + i, length - i, out + o);
+
+                o += run;
+                i += run;
+
+                if (i == length)
+                    break;
+
+                char32_t cp;
+                i += mxl::Detail::DecodeUtf8(bytes, i, length, cp);
+
+                if (cp >= 0x10000)
+                {
+                    cp -= 0x10000;
+                    out[o++] = (char16_t)(0xD800 + (cp >> 10));
+                    out[o++] = (char16_t)(0xDC00 + (cp & 0x3FF));
+                }
+                else
+                {
+                    out[o++] = (char16_t)cp;
+                }
+            }
+
+            return o;
+        }
+    }
+
+
+    inline Utf8Column EncodeUtf8(StridedView<const Variant> column)
+    {
+        Utf8Column result;
+        result.Offsets.resize(column.Size() + 1);
+
+        // Pass 1: exact byte offsets
+        uint64_t total = 0;
+
+        for (uint64_t row = 0; row < column.Size(); row++)
+        {
+            result.Offsets[row] = total;
+
+            if (column[row].IsString())
+            {
+                auto& str = static_cast<const String&>(column[row]);
+                total += Unicode::Utf8Length(str.Buffer(), str.Size());
+            }
+        }
+
+        result.Offsets[column.Size()] = total;
+
+        // Pass 2: encode straight into the single buffer
+        result.Bytes.resize(total);
+
+        for (uint64_t row = 0; row < column.Size(); row++)
+        {
+            if (column[row].IsString())
+            {
+                auto& str = static_cast<const String&>(column[row]);
+                Unicode::ToUtf8(str.Buffer(), str.Size(), result.Bytes.data() + result.Offsets[row]);
+            }
+        }
+
+        return result;
+    }
+
+
+    inline Utf8Column EncodeUtf8(const Array<Variant>& array, const uint64_t col)
+    {
+        return EncodeUtf8(array.ColumnView(col));
+    }
+}
\ No newline at end of file
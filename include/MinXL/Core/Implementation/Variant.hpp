@@ -2,14 +2,354 @@
 
 #include "MinXL/Core/Types.hpp"
 
+#include "MinXL/Core/Interface/Arena.hpp"
 #include "MinXL/Core/Interface/Array.hpp"
 #include "MinXL/Core/Interface/String.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
 #include "MinXL/Core/Interface/Variant.hpp"
 #include "Variant.hpp"
 
 
 namespace mxl
 {
+    namespace Detail
+    {
+        //
+        // Operand classes of the Variant operator tables.
+        //
+        enum class Operand: uint8_t
+        {
+            Empty, Bool, Byte, Int16, Int32, Int64, Float, Double, Date, String, Error, Other
+        };
+
+        enum class Operation: uint8_t
+        {
+            Add, Subtract, Multiply, Divide
+        };
+
+        inline constexpr uint64_t OperandCount      = 12;
+        inline constexpr uint64_t OperationCount    = 4;
+
+
+        inline constexpr auto OperandIDs = []
+        {
+            std::array<Operand, (size_t)Type::ID::Int64 + 1> operands{};
+            operands.fill(Operand::Other);
+
+            operands[(size_t)Type::ID::Empty]   = Operand::Empty;
+            operands[(size_t)Type::ID::Bool]    = Operand::Bool;
+            operands[(size_t)Type::ID::Byte]    = Operand::Byte;
+            operands[(size_t)Type::ID::Int16]   = Operand::Int16;
+            operands[(size_t)Type::ID::Int32]   = Operand::Int32;
+            operands[(size_t)Type::ID::Int64]   = Operand::Int64;
+            operands[(size_t)Type::ID::Float]   = Operand::Float;
+            operands[(size_t)Type::ID::Double]  = Operand::Double;
+            operands[(size_t)Type::ID::Date]    = Operand::Date;
+            operands[(size_t)Type::ID::String]  = Operand::String;
+            operands[(size_t)Type::ID::Error]   = Operand::Error;
+
+            return operands;
+        }();
+
+
+        constexpr Operand OperandOf(const Type::ID id)
+        {
+            return (size_t)id < OperandIDs.size() ? OperandIDs[(size_t)id] : Operand::Other;
+        }
+
+
+        constexpr bool IsNumericOperand(const Operand operand)
+        {
+            return operand >= Operand::Empty && operand <= Operand::Date;
+        }
+
+
+        //
+        // VBA promotion of two numeric operands: the wider integer wins, Single
+        // absorbs Byte and Integer but turns into Double next to Long or
+        // LongLong, and Double absorbs everything. Empty counts as an Integer
+        // zero, a Boolean as an Integer -1/0 and a Date as its Double serial.
+        //
+        consteval Operand Promote(Operand lhs, Operand rhs)
+        {
+            for (auto operand : {&lhs, &rhs})
+            {
+                if (*operand == Operand::Empty || *operand == Operand::Bool)
+                    *operand = Operand::Int16;
+                else if (*operand == Operand::Date)
+                    *operand = Operand::Double;
+            }
+
+            if (lhs == Operand::Float || rhs == Operand::Float)
+            {
+                const auto other = (lhs == Operand::Float) ? rhs : lhs;
+                return (other == Operand::Int32 || other == Operand::Int64 || other == Operand::Double) ? Operand::Double : Operand::Float;
+            }
+
+            return std::max(lhs, rhs);
+        }
+
+
+        template <Operand _Op> struct OperandType                   { using Type = int16_t; };
+        template <> struct OperandType<Operand::Byte>               { using Type = uint8_t; };
+        template <> struct OperandType<Operand::Int32>              { using Type = int32_t; };
+        template <> struct OperandType<Operand::Int64>              { using Type = int64_t; };
+        template <> struct OperandType<Operand::Float>              { using Type = float;   };
+        template <> struct OperandType<Operand::Double>             { using Type = double;  };
+
+
+        //
+        // Every (operation, lhs, rhs) combination gets its own function, and the
+        // tables below are filled at compile time, so a Variant operator is one
+        // table lookup plus one indirect call. Empty slots are invalid operand pairs.
+        //
+        struct VariantDispatch
+        {
+            using ArithmeticFn = Variant (*)(const Variant&, const Variant&);
+            using ComparisonFn = std::partial_ordering (*)(const Variant&, const Variant&);
+
+
+            template <Operand _Op>
+            static auto Value(const Variant& value)
+            {
+                if constexpr (_Op == Operand::Bool)         return (int16_t)(value._Value.Int16 ? -1 : 0);
+                else if constexpr (_Op == Operand::Byte)    return value._Value.Byte;
+                else if constexpr (_Op == Operand::Int16)   return value._Value.Int16;
+                else if constexpr (_Op == Operand::Int32)   return value._Value.Int32;
+                else if constexpr (_Op == Operand::Int64)   return value._Value.Int64;
+                else if constexpr (_Op == Operand::Float)   return value._Value.Float;
+                else if constexpr (_Op == Operand::Double)  return value._Value.Double;
+                else if constexpr (_Op == Operand::Date)    return value._Value.Double;
+                else                                        return int16_t{0};
+            }
+
+
+            template <Operation _Op, typename _Ty>
+            static _Ty Apply(const _Ty lhs, const _Ty rhs)
+            {
+                if constexpr (_Op == Operation::Add)            return lhs + rhs;
+                else if constexpr (_Op == Operation::Subtract)  return lhs - rhs;
+                else if constexpr (_Op == Operation::Multiply)  return lhs * rhs;
+                else                                            return lhs / rhs;
+            }
+
+
+            //
+            // Integer arithmetic; where VBA would raise an overflow the result
+            // widens to Double, which is what Excel computes with anyway.
+            //
+            template <Operation _Op, typename _Ty>
+            static Variant Integer(const _Ty lhs, const _Ty rhs)
+            {
+                constexpr int64_t min = std::numeric_limits<_Ty>::min();
+                constexpr int64_t max = std::numeric_limits<_Ty>::max();
+
+                if constexpr (sizeof(_Ty) < sizeof(int64_t))
+                {
+                    const int64_t result = Apply<_Op>((int64_t)lhs, (int64_t)rhs);
+
+                    if (result >= min && result <= max)
+                        return Variant{(_Ty)result};
+
+                    return Variant{(double)result};
+                }
+                else
+                {
+                    bool overflow;
+
+                    if constexpr (_Op == Operation::Add)
+                        overflow = (rhs > 0 && lhs > max - rhs) || (rhs < 0 && lhs < min - rhs);
+                    else if constexpr (_Op == Operation::Subtract)
+                        overflow = (rhs < 0 && lhs > max + rhs) || (rhs > 0 && lhs < min + rhs);
+                    else
+                        overflow = std::abs((double)lhs * (double)rhs) >= 0x1p63;
+
+                    if (overflow)
+                        return Variant{Apply<_Op>((double)lhs, (double)rhs)};
+
+                    return Variant{Apply<_Op>(lhs, rhs)};
+                }
+            }
+
+
+            template <Operation _Op, Operand _Lhs, Operand _Rhs>
+            static Variant Arithmetic(const Variant& lhs, const Variant& rhs)
+            {
+                using Promoted = typename OperandType<Promote(_Lhs, _Rhs)>::Type;
+
+                const auto a = static_cast<Promoted>(Value<_Lhs>(lhs));
+                const auto b = static_cast<Promoted>(Value<_Rhs>(rhs));
+
+                if constexpr (_Op == Operation::Divide)
+                {
+                    // '/' always yields a floating point quotient
+                    using Quotient = std::conditional_t<Type::IsSame<Promoted, float>, float, double>;
+
+                    if (b == 0)
+                        return Variant{CellError::Div0};
+
+                    return Variant{(Quotient)a / (Quotient)b};
+                }
+                else if constexpr (std::is_floating_point_v<Promoted>)
+                {
+                    return Variant{Apply<_Op>(a, b)};
+                }
+                else
+                {
+                    return Integer<_Op>(a, b);
+                }
+            }
+
+
+            template <Operand _Lhs, Operand _Rhs>
+            static std::partial_ordering Comparison(const Variant& lhs, const Variant& rhs)
+            {
+                using Promoted = typename OperandType<Promote(_Lhs, _Rhs)>::Type;
+
+                return static_cast<Promoted>(Value<_Lhs>(lhs)) <=> static_cast<Promoted>(Value<_Rhs>(rhs));
+            }
+
+
+            // Empty + String and String + Empty give the String, as in VBA; an
+            // error operand is passed on the same way
+            static Variant Left(const Variant& lhs, const Variant&)     { return lhs; }
+            static Variant Right(const Variant&, const Variant& rhs)    { return rhs; }
+
+            // Arithmetic on text
+            static Variant Invalid(const Variant&, const Variant&)      { return Variant{CellError::Value}; }
+
+
+            // The same error compares equal, anything else is unordered
+            static std::partial_ordering Errors(const Variant& lhs, const Variant& rhs)
+            {
+                return lhs._Value.Int32 == rhs._Value.Int32 ? std::partial_ordering::equivalent : std::partial_ordering::unordered;
+            }
+
+            static std::partial_ordering Unordered(const Variant&, const Variant&)
+            {
+                return std::partial_ordering::unordered;
+            }
+
+
+            // Strings compare by contents; Empty compares as an empty string
+            template <Operand _Lhs, Operand _Rhs>
+            static std::partial_ordering Text(const Variant& lhs, const Variant& rhs)
+            {
+                if constexpr (_Lhs == Operand::Empty)
+                    return static_cast<const String&>(rhs).Size() ? std::partial_ordering::less : std::partial_ordering::equivalent;
+                else if constexpr (_Rhs == Operand::Empty)
+                    return static_cast<const String&>(lhs).Size() ? std::partial_ordering::greater : std::partial_ordering::equivalent;
+                else
+                    return static_cast<const String&>(lhs) <=> static_cast<const String&>(rhs);
+            }
+
+
+            template <Operation _Op, Operand _Lhs, Operand _Rhs>
+            static consteval ArithmeticFn ArithmeticEntry()
+            {
+                constexpr bool lhsScalar = IsNumericOperand(_Lhs) || _Lhs == Operand::String;
+                constexpr bool rhsScalar = IsNumericOperand(_Rhs) || _Rhs == Operand::String;
+
+                if constexpr (_Lhs == Operand::Error)
+                    return &Left;
+
+                else if constexpr (_Rhs == Operand::Error)
+                    return &Right;
+
+                else if constexpr (IsNumericOperand(_Lhs) && IsNumericOperand(_Rhs))
+                    return &Arithmetic<_Op, _Lhs, _Rhs>;
+
+                else if constexpr (_Op == Operation::Add && _Lhs == Operand::Empty && _Rhs == Operand::String)
+                    return &Right;
+
+                else if constexpr (_Op == Operation::Add && _Lhs == Operand::String && _Rhs == Operand::Empty)
+                    return &Left;
+
+                else if constexpr (lhsScalar && rhsScalar)
+                    return &Invalid;
+
+                else
+                    return nullptr;
+            }
+
+
+            template <Operand _Lhs, Operand _Rhs>
+            static consteval ComparisonFn ComparisonEntry()
+            {
+                constexpr bool lhsText = _Lhs == Operand::String || _Lhs == Operand::Empty;
+                constexpr bool rhsText = _Rhs == Operand::String || _Rhs == Operand::Empty;
+
+                if constexpr (_Lhs == Operand::Error && _Rhs == Operand::Error)
+                    return &Errors;
+
+                else if constexpr ((_Lhs == Operand::Error) != (_Rhs == Operand::Error))
+                    return &Unordered;
+
+                else if constexpr (IsNumericOperand(_Lhs) && IsNumericOperand(_Rhs))
+                    return &Comparison<_Lhs, _Rhs>;
+
+                else if constexpr (lhsText && rhsText)
+                    return &Text<_Lhs, _Rhs>;
+
+                else
+                    return nullptr;
+            }
+
+
+            template <uint64_t... _I>
+            static consteval auto BuildArithmeticTable(std::integer_sequence<uint64_t, _I...>)
+            {
+                constexpr uint64_t pairs = OperandCount * OperandCount;
+
+                return std::array<ArithmeticFn, sizeof...(_I)>{
+                    ArithmeticEntry<Operation(_I / pairs), Operand(_I / OperandCount % OperandCount), Operand(_I % OperandCount)>()...
+                };
+            }
+
+
+            template <uint64_t... _I>
+            static consteval auto BuildComparisonTable(std::integer_sequence<uint64_t, _I...>)
+            {
+                return std::array<ComparisonFn, sizeof...(_I)>{
+                    ComparisonEntry<Operand(_I / OperandCount), Operand(_I % OperandCount)>()...
+                };
+            }
+
+
+            static ArithmeticFn FindArithmetic(const Operation operation, const Variant& lhs, const Variant& rhs);
+            static ComparisonFn FindComparison(const Variant& lhs, const Variant& rhs);
+        };
+
+
+        // Indexed by [operation][lhs][rhs]
+        inline constexpr auto ArithmeticTable = VariantDispatch::BuildArithmeticTable(std::make_integer_sequence<uint64_t, OperationCount * OperandCount * OperandCount>{});
+
+        // Indexed by [lhs][rhs]
+        inline constexpr auto ComparisonTable = VariantDispatch::BuildComparisonTable(std::make_integer_sequence<uint64_t, OperandCount * OperandCount>{});
+
+
+        inline VariantDispatch::ArithmeticFn VariantDispatch::FindArithmetic(const Operation operation, const Variant& lhs, const Variant& rhs)
+        {
+            return ArithmeticTable[((uint64_t)operation * OperandCount + (uint64_t)OperandOf(lhs._Type)) * OperandCount + (uint64_t)OperandOf(rhs._Type)];
+        }
+
+
+        inline VariantDispatch::ComparisonFn VariantDispatch::FindComparison(const Variant& lhs, const Variant& rhs)
+        {
+            return ComparisonTable[(uint64_t)OperandOf(lhs._Type) * OperandCount + (uint64_t)OperandOf(rhs._Type)];
+        }
+
+
+        inline std::partial_ordering Order(const Variant& lhs, const Variant& rhs)
+        {
+            if (auto compare = VariantDispatch::FindComparison(lhs, rhs))
+                return compare(lhs, rhs);
+
+            MXL_THROW("Invalid attempt to perform comparison between incompatible Variants");
+        }
+    }
+
+
     inline Variant::Variant(): _Type{Type::ID::Empty}, _Value{0}
     {
     }
@@ -17,12 +357,16 @@ namespace mxl
 
     inline Variant::Variant(Variant&& other): _Type{other._Type}, _Value{other._Value}
     {
+        MXL_TRACE(Move, other.PayloadBytes());
+
         std::memset(&other, 0, sizeof(Variant));
     }
 
 
-    inline Variant::Variant(const Variant& other)
+    inline Variant::Variant(const Variant& other MXL_CALLER_PARAM_IMPL)
     {
+        MXL_TRACE_CALLER(caller);
+
         if (other.IsArray())
         {
             Variant temp;
@@ -34,6 +378,9 @@ namespace mxl
                 case Type::ID::Int64:   temp = static_cast<const Array<int64_t>&>(other);  break;
                 case Type::ID::Float:   temp = static_cast<const Array<float>&>(other);    break;
                 case Type::ID::Double:  temp = static_cast<const Array<double>&>(other);   break;
+                case Type::ID::Bool:    temp = static_cast<const Array<Bool>&>(other);     break;
+                case Type::ID::Byte:    temp = static_cast<const Array<Byte>&>(other);     break;
+                case Type::ID::Date:    temp = static_cast<const Array<Date>&>(other);     break;
                 case Type::ID::Variant: temp = static_cast<const Array<Variant>&>(other);  break;
 
                 default:
@@ -84,6 +431,8 @@ namespace mxl
 
         Deallocate();
 
+        MXL_TRACE(Move, other.PayloadBytes());
+
         std::memcpy(this, &other, sizeof(Variant));
         std::memset(&other, 0, sizeof(Variant));
 
@@ -130,6 +479,12 @@ namespace mxl
     }
 
 
+    inline bool Variant::IsError() const
+    {
+        return _Type == Type::ID::Error;
+    }
+
+
     inline bool Variant::IsArray() const
     {
         return (bool)(_Type & Type::ID::Array);
@@ -223,10 +578,7 @@ namespace mxl
     //
     inline Variant::operator String&()
     {
-        if (IsString())
-            return reinterpret_cast<String&>(_Value.String);
-
-        MXL_THROW("Invalid conversion; Variant is not a String");
+        return TryAs<String>().Value();
     }
 
 
@@ -242,14 +594,18 @@ namespace mxl
 
 
     template <ArrayValue _Ty>
-    inline Variant::Variant(const Array<_Ty>& array)
+    inline Variant::Variant(const Array<_Ty>& array MXL_CALLER_PARAM_IMPL)
     {
+        MXL_TRACE_CALLER(caller);
+
         constexpr auto size = sizeof(Array<_Ty>);
 
         Array<_Ty> temp = array;
 
-        if (auto ptr = static_cast<Array<_Ty>*>(std::malloc(size)))
+        if (auto ptr = static_cast<Array<_Ty>*>(Detail::Malloc(size)))
         {
+            MXL_TRACE(Allocate, size);
+
             std::memcpy(ptr, &temp, size);
             std::memset(&temp, 0, size);
 
@@ -266,8 +622,10 @@ namespace mxl
     {
         constexpr auto size = sizeof(Array<_Ty>);
         
-        if (auto ptr = static_cast<Array<_Ty>*>(std::malloc(size)))
+        if (auto ptr = static_cast<Array<_Ty>*>(Detail::Malloc(size)))
         {
+            MXL_TRACE(Allocate, size);
+
             std::memcpy(ptr, &array, size);
             std::memset(&array, 0, size);
 
@@ -285,7 +643,12 @@ namespace mxl
     template <ArrayValue _Ty>
     inline Variant::operator Array<_Ty>() &&
     {
-        Array<_Ty> array = std::move(operator Array<_Ty>&());
+        auto& owned = operator Array<_Ty>&();
+        Array<_Ty> array = std::move(owned);
+
+        // The emptied descriptor was allocated by the Variant
+        MXL_TRACE(Deallocate, sizeof(Array<_Ty>));
+        Detail::Free(&owned);
 
         std::memset(this, 0, sizeof(Variant));
 
@@ -309,19 +672,7 @@ namespace mxl
     template <ArrayValue _Ty>
     inline Variant::operator Array<_Ty>&()
     {
-        if (IsArray())
-        {
-            if (IsArrayOfTypeID(Type::GetID<typename Array<_Ty>::ValueType>()))
-            {
-                return *reinterpret_cast<Array<_Ty>*>(
-                    (std::byte*)_Value.Array - sizeof(ArrayHeader)
-                );
-            }
-
-            MXL_THROW("Invalid conversion; Variant contains Array of different type");
-        }
-        
-        MXL_THROW("Invalid conversion; Variant is not of type Array");
+        return TryAs<Array<_Ty>>().Value();
     }
 
 
@@ -355,21 +706,79 @@ namespace mxl
     template <Numeric _Ty>
     inline Variant::operator _Ty&()
     {
-        if (IsNumeric())
+        return TryAs<_Ty>().Value();
+    }
+
+
+    //
+    // Exposes a reference to the underlying value if it is of type _Ty, or
+    // the reason it is not. Never throws.
+    //
+    // Example:
+    // >>> auto number = arg.TryAs<double>();
+    // >>> if (!number)
+    // >>>     return mxl::Variant{number.Error().Message};
+    // >>> return mxl::Variant{*number * 2};
+    //
+    template <VariantValue _Ty>
+    inline Result<_Ty&> Variant::TryAs()
+    {
+        if constexpr (Numeric<_Ty>)
         {
             if (TypeID() == Type::GetID<_Ty>())
             {
                 if constexpr (Type::IsSame<_Ty, int16_t>)    return _Value.Int16;
-                if constexpr (Type::IsSame<_Ty, int64_t>)    return _Value.Int64;
                 if constexpr (Type::IsSame<_Ty, int32_t>)    return _Value.Int32;
+                if constexpr (Type::IsSame<_Ty, int64_t>)    return _Value.Int64;
                 if constexpr (Type::IsSame<_Ty, float>)      return _Value.Float;
                 if constexpr (Type::IsSame<_Ty, double>)     return _Value.Double;
             }
-            
-            MXL_THROW("Invalid access by reference; Variant is of different numeric type");        
+
+            if (IsNumeric())
+                return MXL_FAILURE("Invalid access by reference; Variant is of different numeric type");
+
+            return MXL_FAILURE("Invalid access by reference; Variant is not Numeric");
+        }
+        else if constexpr (VbaScalar<_Ty>)
+        {
+            if (TypeID() == Type::GetID<_Ty>())
+            {
+                if constexpr (Type::IsSame<_Ty, Bool>)       return reinterpret_cast<Bool&>(_Value.Int16);
+                if constexpr (Type::IsSame<_Ty, Byte>)       return _Value.Byte;
+                if constexpr (Type::IsSame<_Ty, Date>)       return reinterpret_cast<Date&>(_Value.Double);
+            }
+
+            return MXL_FAILURE("Invalid access by reference; Variant is of different type");
         }
+        else if constexpr (Type::IsSame<_Ty, String>)
+        {
+            if (IsString())
+                return reinterpret_cast<String&>(_Value.String);
 
-        MXL_THROW("Invalid access by reference; Variant is not Numeric");
+            return MXL_FAILURE("Invalid conversion; Variant is not a String");
+        }
+        else
+        {
+            if (IsArrayOfTypeID(Type::GetID<typename _Ty::ValueType>()))
+                return *reinterpret_cast<_Ty*>((std::byte*)_Value.Array - sizeof(ArrayHeader));
+
+            if (IsArray())
+                return MXL_FAILURE("Invalid conversion; Variant contains Array of different type");
+
+            return MXL_FAILURE("Invalid conversion; Variant is not of type Array");
+        }
+    }
+
+
+    template <VariantValue _Ty>
+    inline Result<const _Ty&> Variant::TryAs() const
+    {
+        auto result = const_cast<Variant*>(this)->TryAs<_Ty>();
+
+        if (result)
+            return *result;
+
+        return result.Error();
     }
 
 
@@ -385,6 +794,85 @@ namespace mxl
     }
 
 
+    template <VbaScalar _Ty>
+    inline Variant::Variant(_Ty value): _Type{Type::GetID<_Ty>()}
+    {
+        if constexpr (Type::IsSame<_Ty, Bool>)  _Value.Int16  = value.Value;
+        if constexpr (Type::IsSame<_Ty, Byte>)  _Value.Byte   = value;
+        if constexpr (Type::IsSame<_Ty, Date>)  _Value.Double = value.Value;
+    }
+
+
+    //
+    // Exposes a reference to the underlying Boolean, Byte or Date.
+    //
+    template <VbaScalar _Ty>
+    inline Variant::operator _Ty&()
+    {
+        return TryAs<_Ty>().Value();
+    }
+
+
+    template <VbaScalar _Ty>
+    inline Variant::operator const _Ty&() const
+    {
+        return static_cast<const _Ty&>(
+            const_cast<Variant*>(this)->operator _Ty&()
+        );
+    }
+
+
+    inline Variant::Variant(const CellError error): _Type{Type::ID::Error}, _Value{.Int32 = (int32_t)error}
+    {
+    }
+
+
+    //
+    // Returns the Excel error value held by this Variant.
+    //
+    inline CellError Variant::Error() const
+    {
+        if (IsError())
+            return (CellError)_Value.Int32;
+
+        MXL_THROW("Invalid access; Variant is not an error value");
+    }
+
+
+    inline const char* ErrorText(const CellError error)
+    {
+        switch (error)
+        {
+            case CellError::Null:           return "#NULL!";
+            case CellError::Div0:           return "#DIV/0!";
+            case CellError::Value:          return "#VALUE!";
+            case CellError::Ref:            return "#REF!";
+            case CellError::Name:           return "#NAME?";
+            case CellError::Num:            return "#NUM!";
+            case CellError::NA:             return "#N/A";
+            case CellError::GettingData:    return "#GETTING_DATA";
+        }
+
+        return "#ERROR";
+    }
+
+
+    //
+    // Bytes of the string or array buffer this Variant owns (0 for scalars).
+    // Only used to report moves when tracing.
+    //
+    inline uint64_t Variant::PayloadBytes() const
+    {
+        if (IsString())
+            return static_cast<const String&>(*this).Size() * sizeof(char16_t);
+
+        if (IsArray() && _Value.Array)
+            return (uint64_t)_Value.Array->ElementSize * _Value.Array->Rows.ElementCount * _Value.Array->Columns.ElementCount;
+
+        return 0;
+    }
+
+
     //
     // Frees owned resources.
     //
@@ -403,23 +891,8 @@ namespace mxl
 
     inline Variant Variant::operator+(const Variant& other) const
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:     return operator+(other._Value.Int16);
-                case Type::ID::Int32:     return operator+(other._Value.Int32);
-                case Type::ID::Int64:     return operator+(other._Value.Int64);
-                case Type::ID::Float:     return operator+(other._Value.Float);
-                case Type::ID::Double:    return operator+(other._Value.Double);
-                case Type::ID::Empty:     return *this;
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            return other;
-        }
+        if (auto add = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Add, *this, other))
+            return add(*this, other);
 
         MXL_THROW("Invalid attempt to perform addition between one or more non-numeric Variants");
     }
@@ -427,23 +900,8 @@ namespace mxl
 
     inline Variant Variant::operator-(const Variant& other) const
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:     return operator-(other._Value.Int16);
-                case Type::ID::Int32:     return operator-(other._Value.Int32);
-                case Type::ID::Int64:     return operator-(other._Value.Int64);
-                case Type::ID::Float:     return operator-(other._Value.Float);
-                case Type::ID::Double:    return operator-(other._Value.Double);
-                case Type::ID::Empty:     return *this;
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            return other * -1;
-        }
+        if (auto subtract = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Subtract, *this, other))
+            return subtract(*this, other);
 
         MXL_THROW("Invalid attempt to perform subtraction between one or more non-numeric Variants");
     }
@@ -451,23 +909,8 @@ namespace mxl
 
     inline Variant Variant::operator*(const Variant& other) const
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:     return operator*(other._Value.Int16);
-                case Type::ID::Int32:     return operator*(other._Value.Int32);
-                case Type::ID::Int64:     return operator*(other._Value.Int64);
-                case Type::ID::Float:     return operator*(other._Value.Float);
-                case Type::ID::Double:    return operator*(other._Value.Double);
-                case Type::ID::Empty:     return Variant{0.0};
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            return Variant{0.0};
-        }
+        if (auto multiply = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Multiply, *this, other))
+            return multiply(*this, other);
 
         MXL_THROW("Invalid attempt to perform multiplication between one or more non-numeric Variants");
     }
@@ -475,23 +918,8 @@ namespace mxl
 
     inline Variant Variant::operator/(const Variant& other) const
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:     return operator/(other._Value.Int16);
-                case Type::ID::Int32:     return operator/(other._Value.Int32);
-                case Type::ID::Int64:     return operator/(other._Value.Int64);
-                case Type::ID::Float:     return operator/(other._Value.Float);
-                case Type::ID::Double:    return operator/(other._Value.Double);
-                case Type::ID::Empty:     MXL_THROW("Division by empty Variant");
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            return Variant{0.0};
-        }
+        if (auto divide = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Divide, *this, other))
+            return divide(*this, other);
 
         MXL_THROW("Invalid attempt to perform division between one or more non-numeric Variants");
     }
@@ -499,24 +927,8 @@ namespace mxl
 
     inline Variant& Variant::operator+=(const Variant& other)
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    operator+=(other._Value.Int16);    return *this;
-                case Type::ID::Int32:    operator+=(other._Value.Int32);    return *this;
-                case Type::ID::Int64:    operator+=(other._Value.Int64);    return *this;
-                case Type::ID::Float:    operator+=(other._Value.Float);    return *this;
-                case Type::ID::Double:   operator+=(other._Value.Double);   return *this;
-                case Type::ID::Empty:                                       return *this;
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            *this = other;
-            return *this;
-        }
+        if (auto add = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Add, *this, other))
+            return (*this = add(*this, other));
 
         MXL_THROW("Invalid attempt to perform assign-addition between one or more non-numeric Variants");
     }
@@ -524,24 +936,8 @@ namespace mxl
 
     inline Variant& Variant::operator-=(const Variant& other)
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    operator-=(other._Value.Int16);    return *this;
-                case Type::ID::Int32:    operator-=(other._Value.Int32);    return *this;
-                case Type::ID::Int64:    operator-=(other._Value.Int64);    return *this;
-                case Type::ID::Float:    operator-=(other._Value.Float);    return *this;
-                case Type::ID::Double:   operator-=(other._Value.Double);   return *this;
-                case Type::ID::Empty:                                       return *this;
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            *this = other * -1;
-            return *this;
-        }
+        if (auto subtract = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Subtract, *this, other))
+            return (*this = subtract(*this, other));
 
         MXL_THROW("Invalid attempt to perform assign-subtraction between one or more non-numeric Variants");
     }
@@ -549,24 +945,8 @@ namespace mxl
 
     inline Variant& Variant::operator*=(const Variant& other)
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    operator*=(other._Value.Int16);    return *this;
-                case Type::ID::Int32:    operator*=(other._Value.Int32);    return *this;
-                case Type::ID::Int64:    operator*=(other._Value.Int64);    return *this;
-                case Type::ID::Float:    operator*=(other._Value.Float);    return *this;
-                case Type::ID::Double:   operator*=(other._Value.Double);   return *this;
-                case Type::ID::Empty:    operator*=(0.0);                   return *this;
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            *this = Variant{0.0};
-            return *this;
-        }
+        if (auto multiply = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Multiply, *this, other))
+            return (*this = multiply(*this, other));
 
         MXL_THROW("Invalid attempt to perform assign-multiplication between one or more non-numeric Variants");
     }
@@ -574,24 +954,8 @@ namespace mxl
 
     inline Variant& Variant::operator/=(const Variant& other)
     {
-        if (IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    operator/=(other._Value.Int16);    return *this;
-                case Type::ID::Int32:    operator/=(other._Value.Int32);    return *this;
-                case Type::ID::Int64:    operator/=(other._Value.Int64);    return *this;
-                case Type::ID::Float:    operator/=(other._Value.Float);    return *this;
-                case Type::ID::Double:   operator/=(other._Value.Double);   return *this;
-                case Type::ID::Empty:    MXL_THROW("Assign-division by empty Variant");
-                default: ;
-            }
-        }
-        else if (IsEmpty())
-        {
-            *this = Variant{0.0};
-            return *this;
-        }
+        if (auto divide = Detail::VariantDispatch::FindArithmetic(Detail::Operation::Divide, *this, other))
+            return (*this = divide(*this, other));
 
         MXL_THROW("Invalid attempt to perform assign-division between one or more non-numeric Variants");
     }
@@ -599,28 +963,7 @@ namespace mxl
 
     inline bool Variant::operator==(const Variant& other) const
     {
-        if (IsEmpty() && other.IsEmpty())
-        {
-            return true;
-        }
-        else if (IsNumeric() && other.IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    return operator==(other._Value.Int16);
-                case Type::ID::Int32:    return operator==(other._Value.Int32);
-                case Type::ID::Int64:    return operator==(other._Value.Int64);
-                case Type::ID::Float:    return operator==(other._Value.Float);
-                case Type::ID::Double:   return operator==(other._Value.Double);
-                default: ;
-            }
-        }
-        else if (IsString() && other.IsString())
-        {
-            return static_cast<const String&>(*this) == static_cast<const String&>(other);
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between incompatible Variants");
+        return Detail::Order(*this, other) == 0;
     }
 
 
@@ -632,88 +975,25 @@ namespace mxl
 
     inline bool Variant::operator<(const Variant& other) const
     {
-        if (IsEmpty() && other.IsEmpty())
-        {
-            return true;
-        }
-        else if (IsNumeric() && other.IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    return operator<(other._Value.Int16);
-                case Type::ID::Int32:    return operator<(other._Value.Int32);
-                case Type::ID::Int64:    return operator<(other._Value.Int64);
-                case Type::ID::Float:    return operator<(other._Value.Float);
-                case Type::ID::Double:   return operator<(other._Value.Double);
-                default: ;
-            }
-        }
-        else if (IsString() && other.IsString())
-        {
-            return static_cast<const String&>(*this).Size() < static_cast<const String&>(other).Size();
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between incompatible Variants");
+        return Detail::Order(*this, other) < 0;
     }
 
 
     inline bool Variant::operator<=(const Variant& other) const
     {
-        if (IsEmpty() && other.IsEmpty())
-        {
-            return true;
-        }
-        else if (IsNumeric() && other.IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    return operator<=(other._Value.Int16);
-                case Type::ID::Int32:    return operator<=(other._Value.Int32);
-                case Type::ID::Int64:    return operator<=(other._Value.Int64);
-                case Type::ID::Float:    return operator<=(other._Value.Float);
-                case Type::ID::Double:   return operator<=(other._Value.Double);
-                default: ;
-            }
-        }
-        else if (IsString() && other.IsString())
-        {
-            return static_cast<const String&>(*this).Size() <= static_cast<const String&>(other).Size();
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between incompatible Variants");
+        return Detail::Order(*this, other) <= 0;
     }
 
 
     inline bool Variant::operator>(const Variant& other) const
     {
-        return !operator<=(other);
+        return Detail::Order(*this, other) > 0;
     }
 
 
     inline bool Variant::operator>=(const Variant& other) const
     {
-        if (IsEmpty() && other.IsEmpty())
-        {
-            return true;
-        }
-        else if (IsNumeric() && other.IsNumeric())
-        {
-            switch (other._Type)
-            {
-                case Type::ID::Int16:    return operator>=(other._Value.Int16);
-                case Type::ID::Int32:    return operator>=(other._Value.Int32);
-                case Type::ID::Int64:    return operator>=(other._Value.Int64);
-                case Type::ID::Float:    return operator>=(other._Value.Float);
-                case Type::ID::Double:   return operator>=(other._Value.Double);
-                default: ;
-            }
-        }
-        else if (IsString() && other.IsString())
-        {
-            return static_cast<const String&>(*this).Size() >= static_cast<const String&>(other).Size();
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between incompatible Variants");
+        return Detail::Order(*this, other) >= 0;
     }
 
 
@@ -721,14 +1001,17 @@ namespace mxl
     {
         if (IsNumeric())
         {
-            auto ret = *this;
-            ret *= -1;
-            return ret;
+            // Integer -1 keeps the operand's own type
+            return operator*(Variant{(int16_t)-1});
         }
         else if (IsEmpty())
         {
             return Variant{};
         }
+        else if (IsError())
+        {
+            return *this;
+        }
 
         MXL_THROW("Invalid attempt to change signal of non-numeric Variant");
     }
@@ -736,25 +1019,7 @@ namespace mxl
 
     inline Variant& Variant::operator++()
     {
-        if (IsNumeric())
-        {
-            switch (_Type)
-            {
-                case Type::ID::Int16:     _Value.Int16++; break;
-                case Type::ID::Int32:     _Value.Int32++; break;
-                case Type::ID::Int64:     _Value.Int64++; break;
-                case Type::ID::Float:     _Value.Float++; break;
-                case Type::ID::Double:    _Value.Double++; break;
-                case Type::ID::Empty:     *this = Variant{0} + 1; break;
-                default: ;
-            }
-        }
-        else
-        {
-            MXL_THROW("Invalid attempt to pre-increment non-numeric Variant");
-        }
-
-        return *this;
+        return (*this += Variant{(int16_t)1});
     }
 
 
@@ -768,25 +1033,7 @@ namespace mxl
 
     inline Variant& Variant::operator--()
     {
-        if (IsNumeric())
-        {
-            switch (_Type)
-            {
-                case Type::ID::Int16:     _Value.Int16--; break;
-                case Type::ID::Int32:     _Value.Int32--; break;
-                case Type::ID::Int64:     _Value.Int64--; break;
-                case Type::ID::Float:     _Value.Float--; break;
-                case Type::ID::Double:    _Value.Double--; break;
-                case Type::ID::Empty:     *this = Variant{0} - 1; break;
-                default: ;
-            }
-        }
-        else
-        {
-            MXL_THROW("Invalid attempt to pre-decrement non-numeric Variant");
-        }
-
-        return *this;
+        return (*this -= Variant{(int16_t)1});
     }
 
 
@@ -801,324 +1048,196 @@ namespace mxl
     template<Numeric _Ty>
     inline Variant Variant::operator+(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return Variant{(int16_t)    (_Value.Int16  + value) };
-            case Type::ID::Int32:     return Variant{(int32_t)    (_Value.Int32  + value) };
-            case Type::ID::Int64:     return Variant{(int64_t)    (_Value.Int64  + value) };
-            case Type::ID::Float:     return Variant{(float)      (_Value.Float  + value) };
-            case Type::ID::Double:    return Variant{(double)     (_Value.Double + value) };
-            case Type::ID::Empty:     return Variant{value};
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform addition with a non-numeric Variant");
+        return operator+(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant Variant::operator-(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return Variant{(int16_t)    (_Value.Int16  - value) };
-            case Type::ID::Int32:     return Variant{(int32_t)    (_Value.Int32  - value) };
-            case Type::ID::Int64:     return Variant{(int64_t)    (_Value.Int64  - value) };
-            case Type::ID::Float:     return Variant{(float)      (_Value.Float  - value) };
-            case Type::ID::Double:    return Variant{(double)     (_Value.Double - value) };
-            case Type::ID::Empty:     return Variant{-value};
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform subtraction with a non-numeric Variant");
+        return operator-(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant Variant::operator*(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return Variant{(int16_t)    (_Value.Int16  * value) };
-            case Type::ID::Int32:     return Variant{(int32_t)    (_Value.Int32  * value) };
-            case Type::ID::Int64:     return Variant{(int64_t)    (_Value.Int64  * value) };
-            case Type::ID::Float:     return Variant{(float)      (_Value.Float  * value) };
-            case Type::ID::Double:    return Variant{(double)     (_Value.Double * value) };
-            case Type::ID::Empty:     return Variant{0.0};
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform multiplication with a non-numeric Variant");
+        return operator*(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant Variant::operator/(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return Variant{(int16_t)    (_Value.Int16  / value) };
-            case Type::ID::Int32:     return Variant{(int32_t)    (_Value.Int32  / value) };
-            case Type::ID::Int64:     return Variant{(int64_t)    (_Value.Int64  / value) };
-            case Type::ID::Float:     return Variant{(float)      (_Value.Float  / value) };
-            case Type::ID::Double:    return Variant{(double)     (_Value.Double / value) };
-            case Type::ID::Empty:     return Variant{0.0};
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform division with a non-numeric Variant");
+        return operator/(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant& Variant::operator+=(const _Ty value)
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     _Value.Int16    += value; return *this;
-            case Type::ID::Int32:     _Value.Int32    += value; return *this;
-            case Type::ID::Int64:     _Value.Int64    += value; return *this;
-            case Type::ID::Float:     _Value.Float    += value; return *this;
-            case Type::ID::Double:    _Value.Double   += value; return *this;
-            case Type::ID::Empty:     *this = Variant{value};   return *this;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform assign-addition with a non-numeric Variant");
+        return operator+=(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant& Variant::operator-=(const _Ty value)
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     _Value.Int16    -= value; return *this;
-            case Type::ID::Int32:     _Value.Int32    -= value; return *this;
-            case Type::ID::Int64:     _Value.Int64    -= value; return *this;
-            case Type::ID::Float:     _Value.Float    -= value; return *this;
-            case Type::ID::Double:    _Value.Double   -= value; return *this;
-            case Type::ID::Empty:     *this = Variant{-value};  return *this;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform assign-subtraction with a non-numeric Variant");
+        return operator-=(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant& Variant::operator*=(const _Ty value)
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     _Value.Int16    *= value; return *this;
-            case Type::ID::Int32:     _Value.Int32    *= value; return *this;
-            case Type::ID::Int64:     _Value.Int64    *= value; return *this;
-            case Type::ID::Float:     _Value.Float    *= value; return *this;
-            case Type::ID::Double:    _Value.Double   *= value; return *this;
-            case Type::ID::Empty:     *this = Variant{0.0};     return *this;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform assign-multiplication with a non-numeric Variant");
+        return operator*=(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline Variant& Variant::operator/=(const _Ty value)
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     _Value.Int16    /= value; return *this;
-            case Type::ID::Int32:     _Value.Int32    /= value; return *this;
-            case Type::ID::Int64:     _Value.Int64    /= value; return *this;
-            case Type::ID::Float:     _Value.Float    /= value; return *this;
-            case Type::ID::Double:    _Value.Double   /= value; return *this;
-            case Type::ID::Empty:     *this = Variant{0.0};     return *this;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform assign-division with a non-numeric Variant");
+        return operator/=(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline bool Variant::operator==(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return _Value.Int16  == value;
-            case Type::ID::Int32:     return _Value.Int32  == value;
-            case Type::ID::Int64:     return _Value.Int64  == value;
-            case Type::ID::Float:     return _Value.Float  == value;
-            case Type::ID::Double:    return _Value.Double == value;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between a number and a non-numeric Variant");
+        return operator==(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline bool Variant::operator!=(const _Ty value) const
     {
-        return !operator==(value);
+        return operator!=(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline bool Variant::operator<(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return _Value.Int16  < value;
-            case Type::ID::Int32:     return _Value.Int32  < value;
-            case Type::ID::Int64:     return _Value.Int64  < value;
-            case Type::ID::Float:     return _Value.Float  < value;
-            case Type::ID::Double:    return _Value.Double < value;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between a number and a non-numeric Variant");
+        return operator<(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline bool Variant::operator<=(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return _Value.Int16  < value;
-            case Type::ID::Int32:     return _Value.Int32  < value;
-            case Type::ID::Int64:     return _Value.Int64  < value;
-            case Type::ID::Float:     return _Value.Float  < value;
-            case Type::ID::Double:    return _Value.Double < value;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between a number and a non-numeric Variant");
+        return operator<=(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline bool Variant::operator>(const _Ty value) const
     {
-        return !operator<=(value);
+        return operator>(Variant{value});
     }
 
 
     template<Numeric _Ty>
     inline bool Variant::operator>=(const _Ty value) const
     {
-        switch (_Type)
-        {
-            case Type::ID::Int16:     return _Value.Int16  >= value;
-            case Type::ID::Int32:     return _Value.Int32  >= value;
-            case Type::ID::Int64:     return _Value.Int64  >= value;
-            case Type::ID::Float:     return _Value.Float  >= value;
-            case Type::ID::Double:    return _Value.Double >= value;
-            default: ;
-        }
-
-        MXL_THROW("Invalid attempt to perform comparison between a number and a non-numeric Variant");
+        return operator>=(Variant{value});
     }
 
 
     template<Numeric _Ty>
-    inline _Ty operator+(const _Ty value, const Variant& var)
+    inline Variant operator+(const _Ty value, const Variant& var)
     {
-        return value + static_cast<_Ty>(var);
+        return Variant{value} + var;
     }
 
 
     template<Numeric _Ty>
-    inline _Ty operator-(const _Ty value, const Variant& var)
+    inline Variant operator-(const _Ty value, const Variant& var)
     {
-        return value + static_cast<_Ty>(var);
+        return Variant{value} - var;
     }
 
 
     template<Numeric _Ty>
-    inline _Ty operator*(const _Ty value, const Variant& var)
+    inline Variant operator*(const _Ty value, const Variant& var)
     {
-        return value * static_cast<_Ty>(var);
+        return Variant{value} * var;
     }
 
 
     template<Numeric _Ty>
-    inline _Ty operator/(const _Ty value, const Variant& var)
+    inline Variant operator/(const _Ty value, const Variant& var)
     {
-        return value / static_cast<_Ty>(var);
+        return Variant{value} / var;
     }
 
 
     template<Numeric _Ty>
     inline _Ty& operator+=(_Ty& value, const Variant& var)
     {
-        return (value += static_cast<_Ty>(var));
+        return (value = Detail::CellAs<_Ty>(Variant{value} + var));
     }
 
 
     template<Numeric _Ty>
     inline _Ty& operator-=(_Ty& value, const Variant& var)
     {
-        return (value -= static_cast<_Ty>(var));
+        return (value = Detail::CellAs<_Ty>(Variant{value} - var));
     }
 
 
     template<Numeric _Ty>
     inline _Ty& operator*=(_Ty& value, const Variant& var)
     {
-        return (value *= static_cast<_Ty>(var));
+        return (value = Detail::CellAs<_Ty>(Variant{value} * var));
     }
 
 
     template<Numeric _Ty>
     inline _Ty& operator/=(_Ty& value, const Variant& var)
     {
-        return (value /= static_cast<_Ty>(var));
+        return (value = Detail::CellAs<_Ty>(Variant{value} / var));
     }
 
 
     template<Numeric _Ty>
     inline bool operator==(_Ty value, const Variant& var)
     {
-        return (value == static_cast<_Ty>(var));
+        return Variant{value} == var;
     }
 
 
     template<Numeric _Ty>
     inline bool operator!=(_Ty value, const Variant& var)
     {
-        return (value != static_cast<_Ty>(var));
+        return Variant{value} != var;
     }
 
 
     template<Numeric _Ty>
     inline bool operator<(_Ty value, const Variant& var)
     {
-        return (value < static_cast<_Ty>(var));
+        return Variant{value} < var;
     }
 
 
     template<Numeric _Ty>
     inline bool operator<=(_Ty value, const Variant& var)
     {
-        return (value <= static_cast<_Ty>(var));
+        return Variant{value} <= var;
     }
 
 
     template<Numeric _Ty>
     inline bool operator>(_Ty value, const Variant& var)
     {
-        return (value > static_cast<_Ty>(var));
+        return Variant{value} > var;
     }
 
 
     template<Numeric _Ty>
     inline bool operator>=(_Ty value, const Variant& var)
     {
-        return (value >= static_cast<_Ty>(var));
+        return Variant{value} >= var;
     }
 
 
@@ -1133,6 +1252,20 @@ namespace mxl
             case Type::ID::Double:      return os << static_cast<const double&>(var);
             case Type::ID::String:      return os << static_cast<const String&>(var);
             case Type::ID::Empty:       return os << "Empty";
+            case Type::ID::Error:       return os << ErrorText(var.Error());
+            case Type::ID::Bool:        return os << (static_cast<const Bool&>(var) ? "True" : "False");
+            case Type::ID::Byte:        return os << (int)static_cast<const Byte&>(var);
+
+            case Type::ID::Date:
+            {
+                const auto [year, month, day] = Type::DeserializeDate(static_cast<const Date&>(var).Value);
+
+                char text[16];
+                std::snprintf(text, sizeof(text), "%04d-%02d-%02d", (int)year, (int)month, (int)day);
+
+                return os << text;
+            }
+
             default: ;
         }
 
@@ -0,0 +1,370 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+#include "MinXL/Core/Interface/Array.hpp"
+#include "MinXL/Core/Interface/View.hpp"
+
+
+namespace mxl
+{
+    template <ArrayValue _Ty>
+    inline StridedView<_Ty>::Iterator::Iterator(): _Data{nullptr}, _Index{0}, _Stride{1}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline StridedView<_Ty>::Iterator::Iterator(_Ty* data, int64_t index, int64_t stride): _Data{data}, _Index{index}, _Stride{stride}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator*() const -> reference
+    {
+        return _Data[_Index * _Stride];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator->() const -> pointer
+    {
+        return _Data + _Index * _Stride;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator[](difference_type n) const -> reference
+    {
+        return _Data[(_Index + n) * _Stride];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator++() -> Iterator&
+    {
+        _Index++;
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator++(int) -> Iterator
+    {
+        auto temp = *this;
+        _Index++;
+        return temp;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator--() -> Iterator&
+    {
+        _Index--;
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator--(int) -> Iterator
+    {
+        auto temp = *this;
+        _Index--;
+        return temp;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator+=(difference_type n) -> Iterator&
+    {
+        _Index += n;
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator-=(difference_type n) -> Iterator&
+    {
+        _Index -= n;
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator+(difference_type n) const -> Iterator
+    {
+        return Iterator{_Data, _Index + n, _Stride};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator-(difference_type n) const -> Iterator
+    {
+        return Iterator{_Data, _Index - n, _Stride};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::Iterator::operator-(const Iterator& other) const -> difference_type
+    {
+        return _Index - other._Index;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline bool StridedView<_Ty>::Iterator::operator==(const Iterator& other) const
+    {
+        return _Index == other._Index;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline std::strong_ordering StridedView<_Ty>::Iterator::operator<=>(const Iterator& other) const
+    {
+        return _Index <=> other._Index;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline StridedView<_Ty>::StridedView(): _Data{nullptr}, _Size{0}, _Stride{1}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline StridedView<_Ty>::StridedView(_Ty* data, uint64_t size, uint64_t stride)
+        : _Data{data}, _Size{size}, _Stride{stride}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    template <ArrayValue _Other> requires Type::IsSame<_Other, _Ty> && std::is_const_v<_Ty>
+    inline StridedView<_Ty>::StridedView(const StridedView<_Other>& other)
+        : _Data{other.Data()}, _Size{other.Size()}, _Stride{other.Stride()}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline _Ty& StridedView<_Ty>::operator[](const uint64_t index) const
+    {
+        return _Data[index * _Stride];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::begin() const -> Iterator
+    {
+        return Iterator{_Data, 0, (int64_t)_Stride};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto StridedView<_Ty>::end() const -> Iterator
+    {
+        return Iterator{_Data, (int64_t)_Size, (int64_t)_Stride};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BlockView<_Ty>::Iterator::Iterator(): _Data{nullptr}, _Row{0}, _Column{0}, _Rows{0}, _LeadingDim{0}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BlockView<_Ty>::Iterator::Iterator(_Ty* data, uint64_t row, uint64_t column, uint64_t rows, uint64_t leadingDim)
+        : _Data{data}, _Row{row}, _Column{column}, _Rows{rows}, _LeadingDim{leadingDim}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto BlockView<_Ty>::Iterator::operator*() const -> reference
+    {
+        return _Data[_Row + _Column * _LeadingDim];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto BlockView<_Ty>::Iterator::operator->() const -> pointer
+    {
+        return _Data + _Row + _Column * _LeadingDim;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto BlockView<_Ty>::Iterator::operator++() -> Iterator&
+    {
+        // Jump to the top of the next column once the current one is exhausted
+        if (++_Row == _Rows)
+        {
+            _Row = 0;
+            _Column++;
+        }
+
+        return *this;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto BlockView<_Ty>::Iterator::operator++(int) -> Iterator
+    {
+        auto temp = *this;
+        operator++();
+        return temp;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline bool BlockView<_Ty>::Iterator::operator==(const Iterator& other) const
+    {
+        return _Column == other._Column && _Row == other._Row;
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BlockView<_Ty>::BlockView(): _Data{nullptr}, _Rows{0}, _Columns{0}, _LeadingDim{0}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline BlockView<_Ty>::BlockView(_Ty* data, uint64_t rows, uint64_t cols, uint64_t leadingDim)
+        : _Data{data}, _Rows{rows}, _Columns{cols}, _LeadingDim{leadingDim}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    template <ArrayValue _Other> requires Type::IsSame<_Other, _Ty> && std::is_const_v<_Ty>
+    inline BlockView<_Ty>::BlockView(const BlockView<_Other>& other)
+        : _Data{other.Data()}, _Rows{other.Rows()}, _Columns{other.Columns()}, _LeadingDim{other.LeadingDim()}
+    {
+    }
+
+
+    template <ArrayValue _Ty>
+    inline _Ty& BlockView<_Ty>::operator()(const uint64_t row, const uint64_t col) const
+    {
+        return _Data[row + col * _LeadingDim];
+    }
+
+
+    template <ArrayValue _Ty>
+    inline StridedView<_Ty> BlockView<_Ty>::Column(const uint64_t col) const
+    {
+        if (col >= _Columns)
+            MXL_THROW("Column index out of range");
+
+        return StridedView<_Ty>{_Data + col * _LeadingDim, _Rows, 1};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline StridedView<_Ty> BlockView<_Ty>::Row(const uint64_t row) const
+    {
+        if (row >= _Rows)
+            MXL_THROW("Row index out of range");
+
+        return StridedView<_Ty>{_Data + row, _Columns, _LeadingDim};
+    }
+
+
+    template <ArrayValue _Ty>
+    inline auto BlockView<_Ty>::begin() const -> Iterator
+    {
+        // An empty block starts at its own end
+        if (!_Rows || !_Columns)
+            return end();
+
+        return Iterator{_Data, 0, 0, _Rows, _LeadingDim};
+    }
+
+
+    //
+    // Top of the column after the last one, as a position only: its address
+    // may lie beyond the end of the Array.
+    //
+    template <ArrayValue _Ty>
+    inline auto BlockView<_Ty>::end() const -> Iterator
+    {
+        return Iterator{_Data, 0, _Columns, _Rows, _LeadingDim};
+    }
+
+
+    template<ArrayValue _Ty>
+    inline StridedView<_Ty> Array<_Ty>::ColumnView(const uint64_t col)
+    {
+        if (col >= Columns())
+            MXL_THROW("Column index out of range");
+
+        return StridedView<_Ty>{Data() + col * Rows(), Rows(), 1};
+    }
+
+
+    template<ArrayValue _Ty>
+    inline StridedView<const _Ty> Array<_Ty>::ColumnView(const uint64_t col) const
+    {
+        return const_cast<Array<_Ty>*>(this)->ColumnView(col);
+    }
+
+
+    template<ArrayValue _Ty>
+    inline StridedView<_Ty> Array<_Ty>::RowView(const uint64_t row)
+    {
+        if (row >= Rows())
+            MXL_THROW("Row index out of range");
+
+        return StridedView<_Ty>{Data() + row, Columns(), Rows()};
+    }
+
+
+    template<ArrayValue _Ty>
+    inline StridedView<const _Ty> Array<_Ty>::RowView(const uint64_t row) const
+    {
+        return const_cast<Array<_Ty>*>(this)->RowView(row);
+    }
+
+
+    //
+    // Every 'step'-th element in column-major order, starting at 'offset'.
+    //
+    template<ArrayValue _Ty>
+    inline StridedView<_Ty> Array<_Ty>::EveryNth(const uint64_t step, const uint64_t offset)
+    {
+        if (step == 0)
+            MXL_THROW("Invalid step; must be greater than zero");
+
+        if (offset >= Size())
+            return StridedView<_Ty>{Data(), 0, step};
+
+        return StridedView<_Ty>{Data() + offset, (Size() - offset + step - 1) / step, step};
+    }
+
+
+    template<ArrayValue _Ty>
+    inline StridedView<const _Ty> Array<_Ty>::EveryNth(const uint64_t step, const uint64_t offset) const
+    {
+        return const_cast<Array<_Ty>*>(this)->EveryNth(step, offset);
+    }
+
+
+    template<ArrayValue _Ty>
+    inline BlockView<_Ty> Array<_Ty>::Block(const uint64_t row, const uint64_t col, const uint64_t rows, const uint64_t cols)
+    {
+        if (row + rows > Rows() || col + cols > Columns())
+            MXL_THROW("Block exceeds Array bounds");
+
+        return BlockView<_Ty>{Data() + row + col * Rows(), rows, cols, Rows()};
+    }
+
+
+    template<ArrayValue _Ty>
+    inline BlockView<const _Ty> Array<_Ty>::Block(const uint64_t row, const uint64_t col, const uint64_t rows, const uint64_t cols) const
+    {
+        return const_cast<Array<_Ty>*>(this)->Block(row, col, rows, cols);
+    }
+}
\ No newline at end of file
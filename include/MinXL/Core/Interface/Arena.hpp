@@ -0,0 +1,162 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        // Allocation entry points used by Array, String and Variant. They go to the
+        // active Arena if there is one and to the C heap otherwise.
+
+        void*   Malloc(const uint64_t size);
+        void*   Calloc(const uint64_t count, const uint64_t size);
+        void*   Realloc(void* ptr, const uint64_t size, const uint64_t newSize);
+        void    Free(void* ptr);
+        bool    IsArenaMemory(const void* ptr);
+        bool    IsArenaBacked(const Variant& value);
+    }
+
+
+    //
+    // Bump allocator for short-lived Arrays, Strings and Variants.
+    //
+    // Memory is carved sequentially out of large blocks and individual frees are
+    // no-ops; everything is released at once when the owning ArenaScope ends.
+    // Blocks are kept for reuse, so a UDF called repeatedly on the same thread
+    // stops touching the global allocator after its first call.
+    //
+    class Arena
+    {
+    public:
+        static constexpr uint64_t DefaultBlockSize = 1 << 20;
+
+        // Blocks alive at once across all arenas; past this Allocate fails
+        static constexpr uint64_t MaxBlocks = 4096;
+
+        struct Mark
+        {
+            uint64_t    Block;
+            uint64_t    Used;
+        };
+
+        //
+        // Sends allocations on this thread to the C heap for as long as it lives,
+        // even inside an ArenaScope.
+        //
+        class Bypass
+        {
+            Arena* _Saved;
+
+        public:
+            Bypass();
+            ~Bypass();
+        };
+
+    private:
+        struct Block
+        {
+            std::byte*  Data;
+            uint64_t    Capacity;
+            uint64_t    Used;
+        };
+
+        //
+        // Address range of one live block, published so that any thread can
+        // tell arena memory from heap memory without taking a lock. Writers
+        // (block allocation and release, both rare) make Version odd while
+        // they update the range; readers retry if it changed under them.
+        //
+        struct Range
+        {
+            std::atomic<uint64_t>   Version;
+            std::atomic<uintptr_t>  Begin;          // 0 while the slot is free
+            std::atomic<uintptr_t>  End;
+        };
+
+        std::vector<Block>  _Blocks;
+        uint64_t            _Current;
+        uint64_t            _BlockSize;
+
+        static inline thread_local Arena*       _Active = nullptr;
+        static inline std::atomic<uint64_t>     _ActiveScopes{0};
+        static inline Range                     _Ranges[MaxBlocks];
+        static inline std::atomic<uint64_t>     _RangeCount{0};         // Slots ever used
+
+        friend class ArenaScope;
+        friend bool Detail::IsArenaMemory(const void* ptr);
+
+    public:
+        explicit Arena(const uint64_t blockSize = DefaultBlockSize);
+        ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+    public:
+        void*       Allocate(const uint64_t size);
+        bool        Owns(const void* ptr) const;
+
+        Mark        GetMark() const;
+        void        Rewind(const Mark& mark);
+        void        Reset();
+
+        uint64_t    BytesUsed() const;
+        uint64_t    BytesReserved() const;
+
+        // Arena that MinXL allocations on this thread currently go to (or nullptr)
+        static Arena*   Active();
+
+        // Lazily created arena reused by every ArenaScope on this thread
+        static Arena&   ThreadLocal();
+
+    private:
+        // Whether 'ptr' lies in a live block of any arena, on any thread (lock-free)
+        static bool         IsLive(const void* ptr);
+
+        static std::mutex&  RegistryLock();
+        static bool         Publish(const Block& block);
+        static void         Withdraw(const Block& block);
+    };
+
+
+    //
+    // Routes every Array, String and Variant allocation made on this thread to the
+    // thread's Arena until the scope ends, then releases it all in one go.
+    //
+    // Declare the scope before any object that should live in it. Anything that
+    // must survive the scope (e.g. the value returned to VBA) has to go through
+    // Promote(), which moves it into regular malloc memory that the host can free.
+    //
+    // Example:
+    // >>> mxl::Variant MyUDF(mxl::Variant& arg)
+    // >>> {
+    // >>>     mxl::ArenaScope arena;
+    // >>>     mxl::Array<double> temp = ...;
+    // >>>     return arena.Promote(mxl::Variant{std::move(temp)});
+    // >>> }
+    //
+    class ArenaScope
+    {
+    private:
+        Arena&      _Arena;
+        Arena*      _Previous;
+        Arena::Mark _Mark;
+
+    public:
+        ArenaScope();
+        ~ArenaScope();
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    public:
+        Variant                     Promote(Variant&& value);
+        String                      Promote(String&& value);
+        template <ArrayValue _Ty>
+        Array<_Ty>                  Promote(Array<_Ty>&& value);
+
+        inline Arena&               Get()   { return _Arena; }
+    };
+}
\ No newline at end of file
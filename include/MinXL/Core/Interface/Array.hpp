@@ -1,12 +1,17 @@
 #pragma once
 
 #include "MinXL/Core/Types.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
 
 
 namespace mxl
 {
     enum class ArrayFeatures: uint16_t
     {
+        Auto            = 0x00000001,       // Allocated on the host's stack
+        Static          = 0x00000002,       // Statically allocated
+        Embedded        = 0x00000004,       // Part of a host structure
+        FixedSize       = 0x00000010,       // May not be resized or reallocated
         HasVarType      = 0x00000080,
         ArrayOfStrings  = 0x00000100,
         ArrayOfVariants = 0x00000800
@@ -37,9 +42,45 @@ namespace mxl
     };
 
 
+    //
+    // How Unbox treats cells that do not hold a number (Empty, String, etc).
+    // Booleans unbox as -1/0 and Dates as their serial, as in typed conversions.
+    //
+    enum class UnboxPolicy: uint8_t
+    {
+        Zero,       // Non-numeric cells become 0.0 (like SUM ignoring blanks)
+        NaN,        // Non-numeric cells become quiet NaN
+        Throw       // Any non-numeric cell throws mxl::Exception
+    };
+
+
+    //
+    // Result of a single pass over the type tags of an mxl::Array<mxl::Variant>.
+    //
+    struct ArrayCensus
+    {
+        uint64_t    Empty;
+        uint64_t    Double;
+        uint64_t    Numeric;    // Numeric cells other than Double (Byte included)
+        uint64_t    Bool;       // Unboxed as -1/0
+        uint64_t    Date;       // Unboxed as their serial
+        uint64_t    String;
+        uint64_t    Error;      // Excel error values (#N/A, #DIV/0!, ...)
+        uint64_t    Other;
+
+        inline bool AllDouble() const   { return !(Empty | Numeric | Bool | Date | String | Error | Other);    }
+        inline bool AllNumeric() const  { return !(Empty | Bool | Date | String | Error | Other);              }
+        inline bool HasEmpties() const  { return Empty > 0;                                                     }
+        inline bool HasStrings() const  { return String > 0;                                                    }
+        inline bool HasErrors() const   { return Error > 0;                                                     }
+    };
+
+
     template<ArrayValue _Ty = Variant> class Array
     {
         friend class Variant;
+        friend class BorrowedArray<_Ty>;
+        friend class ArrayBuilder<_Ty>;
 
     private:
         ArrayHeader _Header;
@@ -51,14 +92,23 @@ namespace mxl
         Array();
         Array(const uint64_t rows, const uint64_t cols);
 
-        Array(const Array<_Ty>& other);
+        Array(const Array<_Ty>& other MXL_CALLER_PARAM);
         Array(Array<_Ty>&& other);
         Array<_Ty>& operator=(const Array<_Ty>& other);
         Array<_Ty>& operator=(Array<_Ty>&& other);
 
-        Array(const Variant& var);
+        Array(const Variant& var MXL_CALLER_PARAM);
         Array(Variant&& var);
 
+        // Element-wise conversion between Array<Variant> and typed Arrays
+        template <ArrayValue _Fr> explicit Array(const Array<_Fr>& other MXL_CALLER_PARAM)
+            requires (!Type::IsSame<_Ty, _Fr>) && (Type::IsSame<_Ty, Variant> || Type::IsSame<_Fr, Variant>);
+
+        template <ArrayExpression _Ex> Array(const _Ex& expr)
+            requires Type::IsSame<_Ty, Variant> || (!Type::IsSame<typename _Ex::ValueType, Variant>);
+        template <ArrayExpression _Ex> Array<_Ty>& operator=(const _Ex& expr)
+            requires Type::IsSame<_Ty, Variant> || (!Type::IsSame<typename _Ex::ValueType, Variant>);
+
         ~Array();
 
     public:
@@ -74,14 +124,65 @@ namespace mxl
         inline auto Rows() const         { return _Body.Rows.ElementCount;                                           }
         inline auto Columns() const      { return _Body.Columns.ElementCount;                                        }
         inline auto ElementSize() const  { return _Body.ElementSize;                                                 }
+        inline auto Dimensions() const   { return _Body.Dims;                                                        }
         inline auto Column(uint64_t col) { return std::make_pair(&operator()(0, col), &operator()(Rows(), col));     }
 
-        // Test
+        //
+        // Changes the shape, keeping the overlapping elements; new ones are zero
+        // (Empty for Variants) and dropped Variants are released. Keeping the
+        // row count, or keeping at most one column, only changes the tail of
+        // the column-major buffer, which is then resized with realloc.
+        //
         void Resize(const uint64_t rows, const uint64_t cols);
 
+    public:
+
+        // Zero-copy views (see MinXL/Core/Interface/View.hpp)
+
+        StridedView<_Ty>        ColumnView(const uint64_t col);
+        StridedView<const _Ty>  ColumnView(const uint64_t col) const;
+        StridedView<_Ty>        RowView(const uint64_t row);
+        StridedView<const _Ty>  RowView(const uint64_t row) const;
+        StridedView<_Ty>        EveryNth(const uint64_t step, const uint64_t offset = 0);
+        StridedView<const _Ty>  EveryNth(const uint64_t step, const uint64_t offset = 0) const;
+        BlockView<_Ty>          Block(const uint64_t row, const uint64_t col, const uint64_t rows, const uint64_t cols);
+        BlockView<const _Ty>    Block(const uint64_t row, const uint64_t col, const uint64_t rows, const uint64_t cols) const;
+
+    public:
+
+        //
+        // Row-major interop and transposition, done in cache-sized tiles (with
+        // SIMD for double and float). In a row-major buffer, element (row, col)
+        // sits at row * Columns() + col; FromRowMajor keeps the current shape.
+        //
+        void            ToRowMajor(_Ty* out) const                                      requires (!Type::IsSame<_Ty, Variant>);
+        void            FromRowMajor(const _Ty* in)                                     requires (!Type::IsSame<_Ty, Variant>);
+        Array<_Ty>      Transposed() const;
+
+        // In place; square arrays only
+        void            Transpose();
+
+    public:
+
+        // Bulk Variant <=> double kernels (Array<Variant> only)
+
+        ArrayCensus     Census() const                                                  requires Type::IsSame<_Ty, Variant>;
+        void            Unbox(double* out, UnboxPolicy policy) const                    requires Type::IsSame<_Ty, Variant>;
+        void            UnboxColumn(uint64_t col, double* out, UnboxPolicy policy) const requires Type::IsSame<_Ty, Variant>;
+        Array<double>   Unbox(UnboxPolicy policy) const                                 requires Type::IsSame<_Ty, Variant>;
+        void            Box(const double* in)                                           requires Type::IsSame<_Ty, Variant>;
+        void            BoxColumn(uint64_t col, const double* in)                       requires Type::IsSame<_Ty, Variant>;
+
     private:
         bool Allocate(const uint64_t rows, const uint64_t cols);
+        void Adopt(void* buffer, const uint64_t rows, const uint64_t cols);
+        void Release();
         static void Deallocate(ArrayBody* array);
+
+        static void CopyRange(const _Ty* from, _Ty* to, const uint64_t count);
+        static void CensusRange(const Variant* cells, const uint64_t count, ArrayCensus& census);
+        static void UnboxRange(const Variant* cells, const uint64_t count, double* out, UnboxPolicy policy);
+        static void BoxRange(Variant* cells, const uint64_t count, const double* in);
     };
 
 
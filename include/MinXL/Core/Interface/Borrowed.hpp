@@ -0,0 +1,83 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
+
+
+namespace mxl
+{
+    //
+    // Copy-on-write handle over an Array owned by someone else, typically the
+    // host array inside a ByRef VBA argument.
+    //
+    // Reads go straight to the borrowed data, which is never modified or
+    // freed. The elements are split into blocks of BlockSize consecutive
+    // (column-major) elements, and the first write into a block copies just
+    // that block into private memory; later reads and writes of the block use
+    // the copy. A UDF that reads the whole input and changes a few cells thus
+    // copies a few blocks instead of the whole array.
+    //
+    // The borrowed Array must outlive the handle and must not change while it
+    // is in use.
+    //
+    // Example:
+    // >>> extern "C" mxl::Variant Clean(mxl::Variant& range)
+    // >>> {
+    // >>>     mxl::BorrowedArray<mxl::Variant> data{range};
+    // >>>
+    // >>>     for (uint64_t row = 0; row < data.Rows(); row++)
+    // >>>         if (data(row, 2).IsEmpty())
+    // >>>             data.Write(row, 2) = 0.0;
+    // >>>
+    // >>>     return data.Materialize();      // 'range' itself is left untouched
+    // >>> }
+    //
+    template <ArrayValue _Ty>
+    class BorrowedArray
+    {
+    public:
+        static constexpr uint64_t BlockShift    = 12;
+        static constexpr uint64_t BlockSize     = 1ull << BlockShift;
+
+    private:
+        const Array<_Ty>*   _Source;
+        std::vector<_Ty*>   _Blocks;        // nullptr while a block is still borrowed
+        uint64_t            _Copied;
+
+    public:
+        explicit BorrowedArray(const Array<_Ty>& source);
+        explicit BorrowedArray(const Variant& source);
+        ~BorrowedArray();
+
+        BorrowedArray(const BorrowedArray&) = delete;
+        BorrowedArray& operator=(const BorrowedArray&) = delete;
+        BorrowedArray(BorrowedArray&& other);
+        BorrowedArray& operator=(BorrowedArray&& other);
+
+    public:
+        inline uint64_t Rows() const            { return _Source->Rows();       }
+        inline uint64_t Columns() const         { return _Source->Columns();    }
+        inline uint64_t Size() const            { return _Source->Size();       }
+
+        // Number of blocks copied so far
+        inline uint64_t CopiedBlocks() const    { return _Copied;               }
+        bool            IsCopied(const uint64_t row, const uint64_t col) const;
+
+        // Read-only access to the current value
+        const _Ty&      operator[](const uint64_t index) const;
+        const _Ty&      operator()(const uint64_t row, const uint64_t col) const;
+
+        // Writable reference; copies the enclosing block on first use
+        _Ty&            Write(const uint64_t index MXL_CALLER_PARAM);
+        _Ty&            Write(const uint64_t row, const uint64_t col MXL_CALLER_PARAM);
+
+        // Independent Array with every change applied
+        Array<_Ty>      Materialize(MXL_CALLER_PARAM_ONLY) const;
+
+    private:
+        const _Ty*      BlockData(const uint64_t block) const;
+        uint64_t        BlockLength(const uint64_t block) const;
+        _Ty*            CopyBlock(const uint64_t block);
+        void            Release();
+    };
+}
\ No newline at end of file
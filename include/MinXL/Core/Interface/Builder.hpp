@@ -0,0 +1,85 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Builds an Array whose final number of rows isn't known up front, such
+    // as the output of a filter.
+    //
+    // Cells are appended row by row into column-major storage with room for
+    // Capacity() rows per column; when it fills up the capacity doubles, so
+    // appending costs amortized constant time. Finish() packs the columns
+    // together inside the same buffer and hands it to the Array as its host
+    // layout, so the cells are never copied into a final allocation.
+    //
+    // Example:
+    // >>> extern "C" mxl::Variant Positives(mxl::Variant& range)
+    // >>> {
+    // >>>     const auto& data = static_cast<const mxl::Array<mxl::Variant>&>(range);
+    // >>>     mxl::ArrayBuilder<mxl::Variant> result{2};
+    // >>>
+    // >>>     for (uint64_t row = 0; row < data.Rows(); row++)
+    // >>>         if (data(row, 1) > 0.0)
+    // >>>             result.AppendRow(data(row, 0), data(row, 1));
+    // >>>
+    // >>>     return mxl::Variant{result.Finish()};
+    // >>> }
+    //
+    template <ArrayValue _Ty>
+    class ArrayBuilder
+    {
+    public:
+        static constexpr uint64_t MinCapacity = 16;
+
+    private:
+        _Ty*        _Data;
+        uint64_t    _Columns;
+        uint64_t    _Capacity;      // Rows each column has room for
+        uint64_t    _Rows;          // Complete rows
+        uint64_t    _Column;        // Cells already in the row being appended
+
+    public:
+        explicit ArrayBuilder(const uint64_t cols = 1, const uint64_t capacity = 0);
+        ~ArrayBuilder();
+
+        ArrayBuilder(const ArrayBuilder&) = delete;
+        ArrayBuilder& operator=(const ArrayBuilder&) = delete;
+        ArrayBuilder(ArrayBuilder&& other);
+        ArrayBuilder& operator=(ArrayBuilder&& other);
+
+    public:
+        // Rows so far, counting a partially appended one
+        inline uint64_t Rows() const        { return _Rows + (_Column != 0);    }
+        inline uint64_t Columns() const     { return _Columns;                  }
+        inline uint64_t Capacity() const    { return _Capacity;                 }
+
+        // Makes room for at least 'rows' rows in total
+        void            Reserve(const uint64_t rows);
+
+        // Appends one cell, filling each row from left to right
+        template <typename _Tv>
+        void            Append(_Tv&& value);
+
+        // Appends a whole row (one value per column); can't follow a partial row
+        template <typename... _Tv>
+        void            AppendRow(_Tv&&... values);
+
+        // Cell already appended (or still Empty in the current row)
+        _Ty&            operator()(const uint64_t row, const uint64_t col);
+        const _Ty&      operator()(const uint64_t row, const uint64_t col) const;
+
+        //
+        // Moves the cells into an Array of Rows() x Columns(), padding a partial
+        // last row with zeros (Empty for Variants). The builder is left empty
+        // and can be reused.
+        //
+        Array<_Ty>      Finish();
+
+    private:
+        void            Grow(const uint64_t capacity);
+        void            Release();
+    };
+}
\ No newline at end of file
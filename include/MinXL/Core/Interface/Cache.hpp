@@ -0,0 +1,124 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // 64-bit content fingerprints.
+    //
+    // Two values with the same type and contents always get the same
+    // fingerprint; anything else differs with overwhelming probability. Arrays
+    // hash their shape plus their raw numeric data four words at a time, and
+    // strings hash their UTF-16 contents. Storage types are part of the
+    // fingerprint (Int32 1 and Double 1.0 differ), which is conservative for
+    // caching. Types whose contents are not hashed (Currency, Range references,
+    // host String arrays, and arrays holding them) throw instead of colliding.
+    //
+    uint64_t Fingerprint(const Variant& value, const uint64_t seed = 0);
+    uint64_t Fingerprint(const String& value, const uint64_t seed = 0);
+
+    template <ArrayValue _Ty>
+    uint64_t Fingerprint(const Array<_Ty>& value, const uint64_t seed = 0);
+
+    // One fingerprint per argument, ready to be used as a ResultCache key
+    template <typename... _Args>
+    std::vector<uint64_t> Fingerprints(const _Args&... args);
+
+
+    //
+    // Bounded LRU cache of UDF results keyed on (function id, argument fingerprints).
+    //
+    // Capacity is a memory budget: every entry is charged for the full footprint
+    // of its cached Variant (strings and nested arrays included). Inserting past
+    // the budget evicts least recently used entries. Cached values live on the C
+    // heap even when stored from inside an ArenaScope, and a hit hands back a
+    // copy, so callers own what they get. All members are thread-safe.
+    //
+    // Example:
+    // >>> constexpr uint64_t MyUDFId = 1;
+    // >>> mxl::Variant MyUDF(mxl::Variant& range, mxl::Variant& factor)
+    // >>> {
+    // >>>     return mxl::ResultCache::Global().GetOrCompute(MyUDFId, mxl::Fingerprints(range, factor), [&]
+    // >>>     {
+    // >>>         return Compute(range, factor);      // only runs on a miss
+    // >>>     });
+    // >>> }
+    //
+    class ResultCache
+    {
+    public:
+        static constexpr uint64_t DefaultCapacity = 64ull << 20;
+
+        struct Statistics
+        {
+            uint64_t    Hits;
+            uint64_t    Misses;
+            uint64_t    Evictions;
+        };
+
+    private:
+        struct Key
+        {
+            uint64_t                Function;
+            std::vector<uint64_t>   Fingerprints;
+
+            bool operator==(const Key& other) const = default;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct Entry
+        {
+            Key                             Id;
+            std::shared_ptr<const Variant>  Value;
+            uint64_t                        Bytes;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        mutable std::mutex                                          _Lock;
+        EntryList                                                   _Entries;       // Most recently used first
+        std::unordered_map<Key, EntryList::iterator, KeyHash>       _Index;
+        uint64_t                                                    _Capacity;
+        uint64_t                                                    _Bytes;
+        Statistics                                                  _Statistics;
+
+    public:
+        explicit ResultCache(const uint64_t capacity = DefaultCapacity);
+
+        ResultCache(const ResultCache&) = delete;
+        ResultCache& operator=(const ResultCache&) = delete;
+
+    public:
+
+        // Copy of the cached result, or nothing on a miss
+        std::optional<Variant>  Find(const uint64_t function, const std::vector<uint64_t>& fingerprints);
+
+        // Stores (a copy of) 'result', replacing any previous entry for the same key.
+        // Results larger than the whole capacity are not cached.
+        void                    Insert(const uint64_t function, const std::vector<uint64_t>& fingerprints, const Variant& result);
+
+        // Cached result if there is one; otherwise runs compute(), caches and returns its result
+        template <typename _Fn>
+        Variant                 GetOrCompute(const uint64_t function, const std::vector<uint64_t>& fingerprints, _Fn&& compute);
+
+        void                    Clear();
+        void                    SetCapacity(const uint64_t capacity);
+
+        uint64_t                Size() const;
+        uint64_t                BytesUsed() const;
+        uint64_t                Capacity() const;
+        Statistics              Stats() const;
+
+        // Process-wide cache shared by all UDFs
+        static ResultCache&     Global();
+
+    private:
+        void                    Evict(const uint64_t capacity);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Interning pool mapping String contents to compact integer codes.
+    //
+    // Each distinct string is stored once and receives the next free code
+    // (0, 1, 2, ...). Codes from the same pool can be compared, hashed and used
+    // as array indices instead of comparing char16_t buffers.
+    //
+    // The pool's own copies always live on the C heap, so a pool may outlive
+    // any ArenaScope it was filled in.
+    //
+    class StringPool
+    {
+    public:
+        static constexpr uint32_t NotFound = std::numeric_limits<uint32_t>::max();
+
+    private:
+        std::deque<String>                                  _Strings;
+        std::unordered_map<std::u16string_view, uint32_t>   _Codes;
+
+    public:
+        StringPool() = default;
+        StringPool(const StringPool&) = delete;
+        StringPool& operator=(const StringPool&) = delete;
+        StringPool(StringPool&&) = default;
+        StringPool& operator=(StringPool&&) = default;
+
+    public:
+        uint32_t        Intern(const String& str);
+        uint32_t        Intern(std::u16string_view str);
+        uint32_t        Find(const String& str) const;
+        uint32_t        Find(std::u16string_view str) const;
+
+        const String&   operator[](const uint32_t code) const;
+
+        inline auto     Size() const    { return (uint32_t)_Strings.size(); }
+        void            Reserve(const uint64_t count);
+    };
+
+
+    //
+    // Dictionary-encoded column built from the string cells of an Array<Variant>.
+    //
+    // Every cell is replaced by its StringPool code; cells that are not strings
+    // (empties, numbers, ...) get DictionaryColumn::Missing. Columns encoded
+    // against the same pool can be joined or grouped purely on their codes.
+    //
+    // Example:
+    // >>> mxl::StringPool pool;
+    // >>> mxl::DictionaryColumn region{pool, table.ColumnView(2)};
+    // >>> auto counts = region.Histogram();   // rows per distinct region
+    //
+    class DictionaryColumn
+    {
+    public:
+        static constexpr uint32_t Missing = std::numeric_limits<uint32_t>::max();
+
+    private:
+        StringPool*             _Pool;
+        std::vector<uint32_t>   _Codes;
+
+    public:
+        DictionaryColumn(StringPool& pool, StridedView<const Variant> column);
+        DictionaryColumn(StringPool& pool, const Array<Variant>& array, const uint64_t col);
+
+    public:
+        inline uint32_t                     operator[](const uint64_t row) const    { return _Codes[row];   }
+        inline uint64_t                     Size() const                            { return _Codes.size(); }
+        inline const std::vector<uint32_t>& Codes() const                           { return _Codes;        }
+        inline StringPool&                  Pool() const                            { return *_Pool;        }
+
+        // String stored at 'row', or nullptr when the cell was not a string
+        const String*           Decode(const uint64_t row) const;
+
+        // Rows whose cell equals 'str' (integer compares only)
+        std::vector<uint64_t>   Match(const String& str) const;
+
+        // Number of rows per code, indexed by code (Missing cells are not counted)
+        std::vector<uint64_t>   Histogram() const;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        // Element type produced by combining two operands. Anything involving a
+        // Variant stays a Variant; plain numbers follow the usual C++ promotion.
+
+        template <typename _T1, typename _T2>
+        struct ExpressionResult { using type = std::common_type_t<_T1, _T2>; };
+
+        template <typename _T2>
+        struct ExpressionResult<Variant, _T2> { using type = Variant; };
+
+        template <typename _T1>
+        struct ExpressionResult<_T1, Variant> { using type = Variant; };
+
+        template <>
+        struct ExpressionResult<Variant, Variant> { using type = Variant; };
+
+
+        //
+        // Non-owning reference to the data of an mxl::Array inside an expression.
+        //
+        template <ArrayValue _Ty>
+        class ArrayLeaf
+        {
+            const _Ty*  _Data;
+            uint64_t    _Rows;
+            uint64_t    _Columns;
+
+        public:
+            using ValueType = _Ty;
+            static constexpr bool IsScalar = false;
+
+            ArrayLeaf(const Array<_Ty>& array);
+
+            inline uint64_t     Rows() const                            { return _Rows;     }
+            inline uint64_t     Columns() const                         { return _Columns;  }
+            inline const _Ty&   operator[](const uint64_t index) const  { return _Data[index]; }
+        };
+
+
+        //
+        // Numeric constant broadcast to every element of an expression.
+        //
+        template <Numeric _Ty>
+        class ScalarLeaf
+        {
+            _Ty _Value;
+
+        public:
+            using ValueType = _Ty;
+            static constexpr bool IsScalar = true;
+
+            ScalarLeaf(_Ty value);
+
+            inline uint64_t     Rows() const                            { return 0;         }
+            inline uint64_t     Columns() const                         { return 0;         }
+            inline _Ty          operator[](const uint64_t) const        { return _Value;    }
+        };
+
+
+        // Maps an operator argument to the node stored inside the expression
+        // (Arrays by reference, numbers by value, sub-expressions by value).
+
+        template <typename _Ty>
+        struct LeafOf { using type = _Ty; };
+
+        template <ArrayValue _Ty>
+        struct LeafOf<Array<_Ty>> { using type = ArrayLeaf<_Ty>; };
+
+        template <Numeric _Ty>
+        struct LeafOf<_Ty> { using type = ScalarLeaf<_Ty>; };
+
+        template <typename _Ty>
+        using Leaf = typename LeafOf<std::remove_const_t<_Ty>>::type;
+
+
+        // Element-wise operations
+
+        struct Add      { template <typename _Re, typename _T1, typename _T2> static _Re Apply(const _T1& lhs, const _T2& rhs); };
+        struct Subtract { template <typename _Re, typename _T1, typename _T2> static _Re Apply(const _T1& lhs, const _T2& rhs); };
+        struct Multiply { template <typename _Re, typename _T1, typename _T2> static _Re Apply(const _T1& lhs, const _T2& rhs); };
+        struct Divide   { template <typename _Re, typename _T1, typename _T2> static _Re Apply(const _T1& lhs, const _T2& rhs); };
+        struct Negate   { template <typename _Re, typename _T1>               static _Re Apply(const _T1& arg);                  };
+
+
+        // Element type produced by an operation. Division is a true quotient, as
+        // in Excel: integer operands divide as doubles, so 1 / 2 is 0.5 and a zero
+        // divisor gives inf or NaN instead of trapping.
+
+        template <typename _Op, typename _T1, typename _T2>
+        struct OperationResult { using type = typename ExpressionResult<_T1, _T2>::type; };
+
+        template <typename _T1, typename _T2>
+        struct OperationResult<Divide, _T1, _T2>
+        {
+            using type = std::conditional_t<std::is_integral_v<typename ExpressionResult<_T1, _T2>::type>, double, typename ExpressionResult<_T1, _T2>::type>;
+        };
+    }
+
+
+    //
+    // Lazy element-wise combination of two operands. Nothing is computed until the
+    // expression is assigned to an mxl::Array or mxl::Variant, at which point the
+    // whole tree is evaluated in a single pass without intermediate buffers.
+    //
+    // Expressions hold references to the Arrays they were built from, so they must
+    // not outlive them (avoid storing them in 'auto' variables).
+    //
+    // Example:
+    // >>> mxl::Array<double> total = price * quantity * (1.0 - discount);
+    //
+    template <typename _Op, typename _Lhs, typename _Rhs>
+    class BinaryExpression
+    {
+        _Lhs _Left;
+        _Rhs _Right;
+
+    public:
+        using ValueType = typename Detail::OperationResult<_Op, typename _Lhs::ValueType, typename _Rhs::ValueType>::type;
+        static constexpr bool IsScalar = false;
+
+        BinaryExpression(const _Lhs& lhs, const _Rhs& rhs);
+
+        uint64_t    Rows() const;
+        uint64_t    Columns() const;
+        uint64_t    Size() const;
+        ValueType   operator[](const uint64_t index) const;
+    };
+
+
+    //
+    // Lazy element-wise operation over a single operand.
+    //
+    template <typename _Op, typename _Arg>
+    class UnaryExpression
+    {
+        _Arg _Argument;
+
+    public:
+        using ValueType = typename _Arg::ValueType;
+        static constexpr bool IsScalar = false;
+
+        UnaryExpression(const _Arg& arg);
+
+        uint64_t    Rows() const;
+        uint64_t    Columns() const;
+        uint64_t    Size() const;
+        ValueType   operator[](const uint64_t index) const;
+    };
+
+
+    // Array/Expression operators (at least one side must be an Array or Expression)
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    auto operator+(const _T1& lhs, const _T2& rhs);
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    auto operator-(const _T1& lhs, const _T2& rhs);
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    auto operator*(const _T1& lhs, const _T2& rhs);
+
+    template <ExpressionOperand _T1, ExpressionOperand _T2> requires (!(Numeric<_T1> && Numeric<_T2>))
+    auto operator/(const _T1& lhs, const _T2& rhs);
+
+    template <ExpressionOperand _Ty> requires (!Numeric<_Ty>)
+    auto operator-(const _Ty& arg);
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    enum class Aggregate: uint8_t
+    {
+        Sum,        // SUMIFS: sum of the numeric cells
+        Count,      // COUNTIFS: number of rows in the group (the column is ignored)
+        Mean,       // AVERAGEIFS: mean of the numeric cells (#DIV/0! when there are none)
+        Min,        // MINIFS: smallest numeric cell (0 when there are none)
+        Max,        // MAXIFS: largest numeric cell (0 when there are none)
+        First       // Value of the group's first row, whatever its type
+    };
+
+
+    struct Aggregation
+    {
+        uint64_t    Column;
+        Aggregate   Function;
+    };
+
+
+    //
+    // Groups the rows of 'table' by the values in the 'keys' columns and computes
+    // every aggregation per group in one hash-based pass over the rows.
+    //
+    // The result has one row per distinct key combination, in order of first
+    // appearance: the key values first, then one column per aggregation. Keys
+    // compare the way SUMIFS criteria do (numbers by value, text
+    // case-insensitively); empty cells form their own group. Text, empty and
+    // other non-numeric cells are skipped by the numeric aggregations, but an
+    // error value makes the group's result that error, as in SUMIFS. Pass the
+    // result through mxl::Sort for a sorted report.
+    //
+    // Example:
+    // >>> // =SUMIFS(Sales, Region, r, Product, p) and COUNTIFS for every (r, p) at once
+    // >>> auto report = mxl::GroupBy(table, {0, 1}, {{4, mxl::Aggregate::Sum}, {4, mxl::Aggregate::Count}});
+    //
+    Array<Variant> GroupBy(const Array<Variant>& table, const std::vector<uint64_t>& keys, const std::vector<Aggregation>& aggregations);
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Rows whose cells differ between two arrays of the same shape.
+    //
+    // Cells are compared block by block on their raw bytes with SIMD; only
+    // blocks that differ are inspected cell by cell, where strings compare by
+    // contents and nested arrays by fingerprint.
+    //
+    std::vector<uint64_t> ChangedRows(const Array<Variant>& previous, const Array<Variant>& current);
+
+
+    //
+    // Incremental recomputation for row-independent UDFs.
+    //
+    // For every call site (any caller-chosen 64-bit key, e.g. a hash of the
+    // calling cell's address) the cache keeps the previous input and output.
+    // Update() diffs the new input against the previous one and asks the kernel
+    // only for the rows that changed, then patches them into the cached output.
+    // The first call, or a call whose input shape changed, computes every row.
+    //
+    // The kernel is called as kernel(input, rows, patch) and must fill row i of
+    // 'patch' (rows.size() x outputColumns) with the output of input row rows[i].
+    // Cached inputs and outputs live on the C heap, independent of any
+    // ArenaScope around the call. Different sites may be updated concurrently.
+    //
+    // Example:
+    // >>> auto& cache = mxl::IncrementalCache::Global();
+    // >>> return cache.Update(siteId, input, 1, [](auto& in, auto& rows, auto& patch)
+    // >>> {
+    // >>>     for (uint64_t i = 0; i < rows.size(); i++)
+    // >>>         patch(i, 0) = Expensive(in, rows[i]);
+    // >>> });
+    //
+    class IncrementalCache
+    {
+    private:
+        struct Site
+        {
+            std::mutex      Lock;
+            Array<Variant>  Input;
+            Array<Variant>  Output;
+            bool            Valid = false;
+        };
+
+        std::mutex                                              _Lock;
+        std::unordered_map<uint64_t, std::shared_ptr<Site>>     _Sites;
+
+    public:
+        IncrementalCache() = default;
+
+        IncrementalCache(const IncrementalCache&) = delete;
+        IncrementalCache& operator=(const IncrementalCache&) = delete;
+
+    public:
+
+        // Returns the full output for 'input', recomputing only changed rows
+        template <typename _Fn>
+        Array<Variant>      Update(const uint64_t site, const Array<Variant>& input, const uint64_t outputColumns, _Fn&& kernel);
+
+        void                Forget(const uint64_t site);
+        void                Clear();
+        uint64_t            Size();
+
+        // Process-wide cache shared by all UDFs
+        static IncrementalCache& Global();
+
+    private:
+        std::shared_ptr<Site>   GetSite(const uint64_t site);
+    };
+}
\ No newline at end of file
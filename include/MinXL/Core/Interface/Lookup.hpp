@@ -0,0 +1,96 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        // Gather's default for missing rows: #N/A for Variants (as XLOOKUP), 0 for numbers
+        template <ArrayValue _Ty> _Ty LookupMissing();
+    }
+
+
+    //
+    // Hash index over a key column for exact-match lookups (XLOOKUP / MATCH with
+    // match_mode 0).
+    //
+    // Matching follows Excel: numbers match by value whatever their storage type
+    // (1 == 1.0), text matches case-insensitively, booleans only match booleans,
+    // and text never matches a number ("1" != 1). Empty and error cells are not
+    // indexed, so they are never found. When a key occurs more than once the
+    // first row wins, as in a top-down XLOOKUP.
+    //
+    // The index keeps its own copy of the keys, so it stays valid after the
+    // source array is modified or destroyed; build it once and reuse it across
+    // calls while the key data is unchanged. Lookups are read-only and may run
+    // from several threads at once.
+    //
+    // Example:
+    // >>> mxl::LookupIndex index{keys, 0};                      // 500k rows, built once
+    // >>> auto rows = index.Find(needles.ColumnView(0));        // 100k rows in one call
+    // >>> auto result = index.Gather(needles.ColumnView(0), values);  // #N/A where missing
+    //
+    class LookupIndex
+    {
+    public:
+        static constexpr uint64_t NotFound = std::numeric_limits<uint64_t>::max();
+
+    private:
+        struct Slot
+        {
+            uint64_t    Key;        // Number: ordered bits, Text: case-insensitive hash
+            uint64_t    Row;        // NotFound marks a free slot
+        };
+
+        std::vector<Slot>       _Numbers;
+        std::vector<Slot>       _Text;
+        std::vector<uint64_t>   _TextKeys;      // Index into _Strings, parallel to _Text
+        std::vector<String>     _Strings;
+        uint64_t                _Bools[2];
+        uint64_t                _Rows;
+
+    public:
+        explicit LookupIndex(StridedView<const Variant> keys);
+
+        template <Numeric _Ty>
+        explicit LookupIndex(StridedView<_Ty> keys);
+
+        template <ArrayValue _Ty>
+        LookupIndex(const Array<_Ty>& array, const uint64_t col);
+
+    public:
+
+        // Row of the first key equal to 'needle', or NotFound
+        uint64_t                Find(const Variant& needle) const;
+
+        template <Numeric _Ty>
+        uint64_t                Find(const _Ty needle) const;
+
+        // Resolves a whole column of needles (NotFound where there is no match)
+        std::vector<uint64_t>   Find(StridedView<const Variant> needles, const bool parallel = false) const;
+
+        template <Numeric _Ty>
+        std::vector<uint64_t>   Find(StridedView<_Ty> needles, const bool parallel = false) const;
+
+        //
+        // Returns needles.Size() x values.Columns(): row i holds the row of 'values'
+        // matching needle i, or 'ifNotFound' in every column when there is none.
+        // For Variant values a needle that is itself an error value is passed
+        // through instead. 'values' must have as many rows as the indexed key column.
+        //
+        template <ArrayValue _Ty>
+        Array<_Ty>              Gather(StridedView<const Variant> needles, const Array<_Ty>& values, const _Ty& ifNotFound = Detail::LookupMissing<_Ty>(), const bool parallel = false) const;
+
+        // Number of rows in the indexed key column
+        inline uint64_t         Rows() const    { return _Rows; }
+
+    private:
+        void                    Build(StridedView<const Variant> keys);
+        uint64_t                FindNumber(const uint64_t key) const;
+        uint64_t                FindText(const String& needle) const;
+        void                    InsertNumber(const uint64_t key, const uint64_t row);
+        void                    InsertText(const String& key, const uint64_t row);
+    };
+}
\ No newline at end of file
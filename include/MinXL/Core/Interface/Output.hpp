@@ -0,0 +1,36 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Returns an Array of 'rows' x 'cols' elements of type _Ty living inside
+    // 'target', typically a ByRef argument the caller passes to receive the
+    // result, so that a kernel can write its output in place.
+    //
+    // When 'target' already holds a two-dimensional Array<_Ty> of exactly that
+    // shape, its existing data is returned as is: nothing is allocated and the
+    // elements keep their previous values (Variant cells are released as they
+    // are overwritten). Otherwise whatever 'target' held is released and
+    // replaced by a new zeroed Array.
+    //
+    // Arrays the host won't let go of are never released: a fixed-size,
+    // static, stack or embedded array, or one that is locked, throws unless
+    // it already has the right shape and type.
+    //
+    // Example:
+    // >>> ' VBA: the first call creates the array, later ones refill it
+    // >>> Dim result As Variant
+    // >>> For i = 1 To 10000: Fill inputs, result: Next
+    // >>>
+    // >>> extern "C" void Fill(mxl::Variant& inputs, mxl::Variant& result)
+    // >>> {
+    // >>>     auto& out = mxl::PrepareOutput<double>(result, 1000, 1);
+    // >>>     ...                                 // write out(row, 0)
+    // >>> }
+    //
+    template <ArrayValue _Ty>
+    Array<_Ty>& PrepareOutput(Variant& target, const uint64_t rows, const uint64_t cols);
+}
\ No newline at end of file
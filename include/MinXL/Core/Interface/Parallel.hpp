@@ -0,0 +1,118 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Library-lifetime work-stealing thread pool.
+    //
+    // The pool is created on first use and joined when the library is unloaded
+    // (static destruction), so UDFs never pay for spawning threads. Each worker
+    // owns a task deque: it pops its own tasks LIFO and steals from the front of
+    // the others' when idle. The calling thread takes part in the work while it
+    // waits, so nested parallel calls cannot deadlock.
+    //
+    // Most code should use mxl::ParallelFor / mxl::ParallelReduce instead of
+    // talking to the pool directly.
+    //
+    class ThreadPool
+    {
+    private:
+        struct Batch
+        {
+            const std::function<void(uint64_t)>*   Job;
+            std::atomic<uint64_t>                   Remaining;
+            std::exception_ptr                      Error;
+            std::mutex                              ErrorLock;
+        };
+
+        struct Task
+        {
+            Batch*      Owner;
+            uint64_t    Index;
+        };
+
+        struct Queue
+        {
+            std::mutex          Lock;
+            std::deque<Task>    Tasks;
+        };
+
+        std::vector<std::thread>                _Workers;
+        std::vector<std::unique_ptr<Queue>>     _Queues;
+        std::atomic<int64_t>                    _Pending;           // Briefly negative while a batch is being queued
+        std::atomic<uint64_t>                   _NextQueue;
+        std::mutex                              _SleepLock;
+        std::condition_variable                 _Wake;
+        bool                                    _Stop;
+
+        static inline thread_local int64_t      _WorkerIndex = -1;
+
+    public:
+        static ThreadPool& Instance();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ~ThreadPool();
+
+    public:
+        // Number of threads that execute work (workers + calling thread)
+        uint64_t    Concurrency() const;
+
+        // Runs job(0) ... job(count - 1) on the pool and blocks until all finished.
+        // The first exception thrown by any job is rethrown on the calling thread.
+        void        Dispatch(const uint64_t count, const std::function<void(uint64_t)>& job);
+
+    private:
+        explicit ThreadPool(const uint64_t workers);
+
+        void        WorkerLoop(const uint64_t index);
+        bool        TryPop(const uint64_t queue, Task& task);
+        bool        TrySteal(const uint64_t thief, Task& task);
+        bool        TryAcquire(Task& task);
+        static void Execute(const Task& task);
+    };
+
+
+    // Default chunk size for ParallelReduce. Fixed (rather than derived from the
+    // thread count) so that floating-point reductions give identical results on
+    // every machine.
+    inline constexpr uint64_t DefaultReduceGrain = 16384;
+
+
+    //
+    // Calls fn(first, last) over disjoint chunks of [begin, end) in parallel.
+    // 'grain' is the chunk size; 0 picks about four chunks per thread (at least 1024 indices).
+    //
+    // Example:
+    // >>> mxl::ParallelFor(0, n, [&](uint64_t first, uint64_t last) {
+    // >>>     for (auto i = first; i < last; i++) out[i] = std::exp(in[i]);
+    // >>> });
+    //
+    template <typename _Fn>
+    void ParallelFor(const uint64_t begin, const uint64_t end, _Fn&& fn, uint64_t grain = 0);
+
+    //
+    // Reduces [begin, end) in parallel. map(first, last) produces one partial result per
+    // chunk, and partials are folded with combine(acc, partial) strictly in chunk order,
+    // so the result does not depend on scheduling.
+    //
+    template <typename _Re, typename _Map, typename _Combine>
+    _Re ParallelReduce(const uint64_t begin, const uint64_t end, _Re identity, _Map&& map, _Combine&& combine, uint64_t grain = DefaultReduceGrain);
+
+    // Same as above, over the flat (column-major) indices of an mxl::Array.
+
+    template <ArrayValue _Ty, typename _Fn>
+    void ParallelFor(const Array<_Ty>& array, _Fn&& fn, uint64_t grain = 0);
+
+    template <ArrayValue _Ty, typename _Re, typename _Map, typename _Combine>
+    _Re ParallelReduce(const Array<_Ty>& array, _Re identity, _Map&& map, _Combine&& combine, uint64_t grain = DefaultReduceGrain);
+
+    //
+    // Calls fn(col) for every column of an mxl::Array in parallel, 'grain' columns per task.
+    //
+    template <ArrayValue _Ty, typename _Fn>
+    void ParallelForColumns(const Array<_Ty>& array, _Fn&& fn, uint64_t grain = 1);
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+//
+// Profiles the enclosing scope as the entry point 'name' (a string literal)
+// that processed 'cells' input cells.
+//
+// Example:
+// >>> extern "C" mxl::Variant MyUDF(mxl::Variant& range)
+// >>> {
+// >>>     MXL_PROFILE("MyUDF", mxl::Profile::Cells(range));
+// >>>     ...
+// >>> }
+//
+#define MXL_PROFILE(name, cells)                                                                        \
+    static const uint32_t MXL_PROFILE_CONCAT(mxlProfileEntry, __LINE__) = mxl::Profile::Register(name); \
+    mxl::Profile::Probe MXL_PROFILE_CONCAT(mxlProfileProbe, __LINE__){MXL_PROFILE_CONCAT(mxlProfileEntry, __LINE__), (cells)}
+
+#define MXL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MXL_PROFILE_CONCAT(a, b) MXL_PROFILE_CONCAT_IMPL(a, b)
+
+
+namespace mxl
+{
+    //
+    // Per-entry-point profiler for exported UDFs.
+    //
+    // Every thread records into its own counters and log-linear latency
+    // histogram (16 sub-buckets per power of two, so percentiles are within
+    // about 6%); a probe costs two clock reads and a handful of uncontended
+    // relaxed atomic stores. Readers merge all threads on demand.
+    //
+    // On Linux, EnableHardwareCounters() additionally counts user-space cycles
+    // and instructions per call with perf_event_open. It costs two system calls
+    // per probe and silently stays off where perf events are not permitted.
+    //
+    namespace Profile
+    {
+        inline constexpr uint32_t MaxEntryPoints    = 256;
+        inline constexpr uint32_t SubBuckets        = 16;
+        inline constexpr uint32_t Buckets           = SubBuckets + 60 * SubBuckets;
+
+
+        struct EntryStats
+        {
+            std::string Name;
+            uint64_t    Calls;
+            uint64_t    Cells;
+            uint64_t    TotalNs;
+            uint64_t    MaxNs;
+            uint64_t    P50Ns;
+            uint64_t    P90Ns;
+            uint64_t    P99Ns;
+            uint64_t    Cycles;             // 0 without hardware counters
+            uint64_t    Instructions;       // 0 without hardware counters
+        };
+
+
+        //
+        // Times one call of an entry point; normally created by MXL_PROFILE.
+        //
+        class Probe
+        {
+        private:
+            uint32_t    _Entry;
+            uint64_t    _Cells;
+            uint64_t    _Start;
+            uint64_t    _Hardware[2];
+            bool        _HasHardware;       // Whether _Hardware holds a reading from the constructor
+
+        public:
+            Probe(const uint32_t entry, const uint64_t cells);
+            ~Probe();
+
+            Probe(const Probe&) = delete;
+            Probe& operator=(const Probe&) = delete;
+        };
+
+
+        // Id of the entry point called 'name', registering it on first use
+        uint32_t                Register(const char* name);
+
+        // Number of cells in a UDF argument (1 for scalars, rows * columns for arrays)
+        uint64_t                Cells(const Variant& value);
+
+        // Returns whether hardware counters are now on
+        bool                    EnableHardwareCounters(const bool enable = true);
+
+        std::vector<EntryStats> Snapshot();
+        void                    Reset();
+
+        //
+        // Header row plus one row per entry point that has been called:
+        // Entry, Calls, Cells, Total ms, Mean us, P50 us, P90 us, P99 us, Max us,
+        // Cycles, Instructions. Ready to be returned to a sheet by a diagnostic UDF.
+        //
+        Array<Variant>          Table();
+
+        // Writes the same table as text; Dump(path) returns false if the file can't be opened
+        void                    Dump(std::ostream& os);
+        bool                    Dump(const std::string& path);
+    }
+}
\ No newline at end of file
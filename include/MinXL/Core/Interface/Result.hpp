@@ -0,0 +1,88 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Either a value or the Failure that prevented producing it.
+    //
+    // Lets hot loops check for bad input without paying for a throw per cell;
+    // Value() still throws the Failure as an mxl::Exception for callers that
+    // prefer exceptions. Result<_Ty&> refers to an existing object instead of
+    // holding a copy.
+    //
+    // Example:
+    // >>> for (auto& cell : range)
+    // >>> {
+    // >>>     if (auto value = cell.TryAs<double>())
+    // >>>         sum += *value;
+    // >>>     else
+    // >>>         skipped++;
+    // >>> }
+    //
+    template <typename _Ty>
+    class Result
+    {
+    private:
+        std::optional<_Ty>  _Value;
+        Failure             _Failure{};
+
+    public:
+        Result(const _Ty& value): _Value{value} {}
+        Result(_Ty&& value): _Value{std::move(value)} {}
+        Result(const Failure& failure): _Failure{failure} {}
+
+    public:
+        inline bool             HasValue() const            { return _Value.has_value(); }
+        inline explicit         operator bool() const       { return _Value.has_value(); }
+
+        // Throws the Failure if there is no value
+        _Ty&                    Value() &;
+        const _Ty&              Value() const &;
+        _Ty&&                   Value() &&;
+
+        _Ty                     ValueOr(_Ty fallback) const &;
+        _Ty                     ValueOr(_Ty fallback) &&;
+
+        // Unchecked access; only valid when HasValue()
+        inline _Ty&             operator*() &               { return *_Value; }
+        inline const _Ty&       operator*() const &         { return *_Value; }
+        inline _Ty&&            operator*() &&              { return std::move(*_Value); }
+        inline _Ty*             operator->()                { return &*_Value; }
+        inline const _Ty*       operator->() const          { return &*_Value; }
+
+        // Only meaningful when !HasValue()
+        inline const Failure&   Error() const               { return _Failure; }
+    };
+
+
+    template <typename _Ty>
+    class Result<_Ty&>
+    {
+    private:
+        _Ty*                _Value = nullptr;
+        Failure             _Failure{};
+
+    public:
+        Result(_Ty& value): _Value{&value} {}
+        Result(const Failure& failure): _Failure{failure} {}
+
+    public:
+        inline bool             HasValue() const            { return _Value != nullptr; }
+        inline explicit         operator bool() const       { return _Value != nullptr; }
+
+        // Throws the Failure if there is no value
+        _Ty&                    Value() const;
+
+        _Ty&                    ValueOr(_Ty& fallback) const;
+
+        // Unchecked access; only valid when HasValue()
+        inline _Ty&             operator*() const           { return *_Value; }
+        inline _Ty*             operator->() const          { return _Value; }
+
+        // Only meaningful when !HasValue()
+        inline const Failure&   Error() const               { return _Failure; }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    namespace Detail
+    {
+        // Excel's cross-type sort classes, in ascending order
+        enum class SortClass: uint8_t
+        {
+            Number,
+            Text,
+            Bool,
+            Error,
+            Empty
+        };
+
+        //
+        // Sort class of a cell plus a 64-bit key ordered within the class: the
+        // order-preserving image of numbers (equal numbers of any type share it),
+        // a case-folded prefix for text and 0/1 for booleans.
+        //
+        struct SortCell
+        {
+            SortClass   Class;
+            uint64_t    Key;
+
+            static SortCell Of(const Variant& cell);
+        };
+
+        // Unsigned integer with the same ordering as 'value' (-0.0 maps like 0.0)
+        uint64_t OrderedBits(double value);
+        double   FromOrderedBits(const uint64_t bits);
+    }
+
+
+    enum class SortOrder: uint8_t
+    {
+        Ascending,
+        Descending
+    };
+
+
+    //
+    // One sort key of a row sort: the column to compare and its direction.
+    // Keys are applied in order; later keys only break ties of earlier ones.
+    //
+    struct SortKey
+    {
+        uint64_t    Column;
+        SortOrder   Order = SortOrder::Ascending;
+    };
+
+
+    //
+    // Sort engine following Excel's SORT/SORTBY semantics.
+    //
+    // Cells are ordered numbers < text < booleans < errors in ascending order
+    // (reversed when descending), and empty cells always go last. Text compares
+    // case-insensitively. All sorts are stable, so rows with equal keys keep
+    // their original relative order.
+    //
+    // Numeric keys (including Dates) are radix-sorted on order-preserving
+    // 64-bit images of their values; text is sorted on a normalized
+    // case-folded prefix key, falling back to a full comparison only on ties.
+    // With 'parallel' set, key extraction and text sorting run on the
+    // mxl::ThreadPool.
+    //
+    // Example:
+    // >>> // Region ascending, then Sales descending
+    // >>> auto order = mxl::SortPermutation(table, {{2}, {5, mxl::SortOrder::Descending}});
+    // >>> auto sorted = mxl::Permute(table, order);
+    // >>> auto other  = mxl::Permute(otherColumns, order);     // same row order, no re-sort
+    //
+
+    // Row permutation that sorts a single column: result[i] is the source row of sorted row i
+    std::vector<uint64_t>   SortPermutation(StridedView<const Variant> column, const SortOrder order = SortOrder::Ascending, const bool parallel = false);
+
+    template <Numeric _Ty>
+    std::vector<uint64_t>   SortPermutation(StridedView<_Ty> column, const SortOrder order = SortOrder::Ascending, const bool parallel = false);
+
+    // Row permutation that sorts an array by several columns
+    template <ArrayValue _Ty>
+    std::vector<uint64_t>   SortPermutation(const Array<_Ty>& array, const std::vector<SortKey>& keys, const bool parallel = false);
+
+    // Copy of 'array' whose row i is row rows[i] of the source
+    template <ArrayValue _Ty>
+    Array<_Ty>              Permute(const Array<_Ty>& array, const std::vector<uint64_t>& rows);
+
+    // Sorted copy of 'array' (by its first column when no keys are given)
+    template <ArrayValue _Ty>
+    Array<_Ty>              Sort(const Array<_Ty>& array, const std::vector<SortKey>& keys = {SortKey{0}}, const bool parallel = false);
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MinXL/Core/Types.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
 
 
 namespace mxl
@@ -19,6 +20,29 @@ namespace mxl
     };
 
 
+    namespace Detail
+    {
+        // Simple lowercase mapping used by case-insensitive comparisons
+        char16_t FoldCase(const char16_t c);
+
+        // Mixing steps of String::Hash, reusable to hash any stream of 64-bit words
+        uint64_t HashStep(const uint64_t hash, const uint64_t word);
+        uint64_t HashFinal(uint64_t hash);
+    }
+
+
+    //
+    // How String comparisons and hashes treat letter case. Insensitive folds
+    // Latin, Greek and Cyrillic letters the way Excel's own comparisons,
+    // MATCH and XLOOKUP do.
+    //
+    enum class CaseSensitivity
+    {
+        Sensitive,
+        Insensitive
+    };
+
+
     class String
     {
         friend class Variant;
@@ -29,10 +53,12 @@ namespace mxl
 
     public:
         String();
-        String(const String& other);
+        String(const String& other MXL_CALLER_PARAM);
         String(String&& other);
         String(const char16_t* str);
+        String(const char16_t* str, const uint64_t length);
         String(const char* str);
+        String(std::string_view utf8);
         String(const Variant& var);
         String(Variant&& var);
 
@@ -50,20 +76,52 @@ namespace mxl
         uint64_t                Size() const;
         char16_t*               Buffer() const;
         std::unique_ptr<char[]> CStr() const;
+        std::string             Utf8() const;
 
         bool                    operator==(const String& other) const;
         bool                    operator!=(const String& other) const;
+        std::strong_ordering    operator<=>(const String& other) const;
+
+        // Three-way comparison by UTF-16 code unit, optionally ignoring case
+        std::weak_ordering      Compare(const String& other, const CaseSensitivity sensitivity = CaseSensitivity::Sensitive) const;
+        bool                    Equals(const String& other, const CaseSensitivity sensitivity = CaseSensitivity::Sensitive) const;
+
+        // Hash consistent with Equals() under the same sensitivity
+        uint64_t                Hash(const CaseSensitivity sensitivity = CaseSensitivity::Sensitive) const;
 
     private:
-        static bool Compare(const char16_t* lhs, const char16_t* rhs);
-        static std::unique_ptr<char[]> Char16to8(const char16_t* str);
-        static std::unique_ptr<char16_t[]> Char8to16(const char* str);
+        static std::unique_ptr<char[]> Char16to8(const char16_t* str, const uint64_t length);
 
     private:
-        void                    Allocate(const char16_t* str);
+        void                    Allocate(const uint64_t length);
+        void                    Allocate(const char16_t* str, const uint64_t length);
         static void             Deallocate(char16_t* str);
     };
 
 
     std::ostream& operator<<(std::ostream &os, const String& str);
-}
\ No newline at end of file
+
+
+    //
+    // Hash and equality functors for case-insensitive containers.
+    //
+    // Example:
+    // >>> std::unordered_map<mxl::String, uint64_t, mxl::StringHashNoCase, mxl::StringEqualNoCase> rows;
+    //
+    struct StringHashNoCase
+    {
+        inline uint64_t operator()(const String& str) const                     { return str.Hash(CaseSensitivity::Insensitive);         }
+    };
+
+    struct StringEqualNoCase
+    {
+        inline bool     operator()(const String& lhs, const String& rhs) const  { return lhs.Equals(rhs, CaseSensitivity::Insensitive);  }
+    };
+}
+
+
+template <>
+struct std::hash<mxl::String>
+{
+    inline size_t operator()(const mxl::String& str) const { return str.Hash(); }
+};
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+//
+// Allocation and copy tracing.
+//
+// Build with MXL_TRACE_ALLOCATIONS defined (e.g. -DMXL_TRACE_ALLOCATIONS, or
+// the MINXL_TRACE_ALLOCATIONS CMake option) to have Array, String and Variant
+// report every allocation, deallocation, deep copy and move, with its size in
+// bytes and where it happened. The public copy paths (copy constructors,
+// Variant <=> Array conversions, BorrowedArray) take the caller's source
+// location, so a deep copy is reported at the line of user code that asked
+// for it; anything else is reported at the enclosing MXL_TRACE_SCOPE, and
+// only outside any scope at the MinXL line that performed it. Without the
+// define the hooks compile to nothing and those extra parameters are not
+// declared at all, so signatures stay the plain ones.
+//
+#if defined(MXL_TRACE_ALLOCATIONS)
+#define MXL_TRACE(event, bytes) mxl::Trace::Record(mxl::Trace::Event::event, (bytes), MXL_WHERE)
+#define MXL_TRACE_SCOPE(name) mxl::Trace::Scope MXL_TRACE_CONCAT(mxlTraceScope, __LINE__){name}
+#define MXL_TRACE_CALLER(where) mxl::Trace::CallSite MXL_TRACE_CONCAT(mxlTraceCallSite, __LINE__){where}
+#define MXL_CALLER_PARAM_ONLY const std::source_location caller = std::source_location::current()
+#define MXL_CALLER_PARAM_IMPL_ONLY const std::source_location caller
+#define MXL_CALLER_PARAM , MXL_CALLER_PARAM_ONLY
+#define MXL_CALLER_PARAM_IMPL , MXL_CALLER_PARAM_IMPL_ONLY
+#define MXL_CALLER_ARG , caller
+#else
+#define MXL_TRACE(event, bytes) ((void)0)
+#define MXL_TRACE_SCOPE(name) ((void)0)
+#define MXL_TRACE_CALLER(where) ((void)0)
+#define MXL_CALLER_PARAM_ONLY
+#define MXL_CALLER_PARAM_IMPL_ONLY
+#define MXL_CALLER_PARAM
+#define MXL_CALLER_PARAM_IMPL
+#define MXL_CALLER_ARG
+#endif
+
+#define MXL_TRACE_CONCAT_IMPL(a, b) a##b
+#define MXL_TRACE_CONCAT(a, b) MXL_TRACE_CONCAT_IMPL(a, b)
+
+
+namespace mxl
+{
+    namespace Trace
+    {
+#if defined(MXL_TRACE_ALLOCATIONS)
+        inline constexpr bool Enabled = true;
+#else
+        inline constexpr bool Enabled = false;
+#endif
+
+        enum class Event: uint8_t
+        {
+            Allocate,
+            Deallocate,
+            DeepCopy,
+            Move
+        };
+
+
+        struct Counters
+        {
+            uint64_t    Allocations;
+            uint64_t    Deallocations;
+            uint64_t    DeepCopies;
+            uint64_t    Moves;
+            uint64_t    BytesAllocated;
+            uint64_t    BytesFreed;
+            uint64_t    BytesCopied;
+            uint64_t    BytesMoved;         // What the moves would have cost as copies
+
+            // Allocated minus freed. Host buffers freed by MinXL count as freed
+            // without having been allocated, so this can go below zero.
+            int64_t     LiveBytes;
+            int64_t     PeakBytes;          // High-water mark of LiveBytes
+        };
+
+
+        // Aggregate of every run of a named Scope
+        struct ScopeSummary
+        {
+            std::string Name;
+            uint64_t    Calls;
+            Counters    Totals;             // PeakBytes is the highest of any single run
+        };
+
+
+        //
+        // Counts everything that happens on this thread while it lives. Scopes
+        // nest; each one reports its own totals and its own high-water mark
+        // (relative to the live bytes when it started), and its summary is
+        // merged into Summaries() under its name when it ends.
+        //
+        // Example:
+        // >>> mxl::Variant MyUDF(mxl::Variant& arg)
+        // >>> {
+        // >>>     MXL_TRACE_SCOPE("MyUDF");
+        // >>>     ...
+        // >>> }
+        //
+        class Scope
+        {
+        private:
+            const char*             _Name;
+            std::source_location    _Where;
+            Scope*                  _Parent;
+            Counters                _Start;
+            int64_t                 _SavedPeak;
+
+        public:
+            explicit Scope(const char* name, const std::source_location where = std::source_location::current());
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        public:
+            // Totals since the scope started
+            Counters    Current() const;
+            const char* Name() const    { return _Name; }
+            const auto& Where() const   { return _Where; }
+
+            // Innermost scope on this thread, or nullptr
+            static const Scope* Active();
+        };
+
+
+        //
+        // Attributes the events recorded while it lives to 'where', a call site
+        // in user code; normally created by MXL_TRACE_CALLER in the public copy
+        // paths. The outermost user call site wins, and locations inside MinXL
+        // itself (its own internal copies) are ignored.
+        //
+        class CallSite
+        {
+        private:
+            bool    _Active;
+
+        public:
+            explicit CallSite(const std::source_location& where);
+            ~CallSite();
+
+            CallSite(const CallSite&) = delete;
+            CallSite& operator=(const CallSite&) = delete;
+        };
+
+
+        // Called by the MXL_TRACE hooks
+        void                        Record(const Event event, const uint64_t bytes, const char* where);
+
+        Counters                    ThreadCounters();
+        Counters                    GlobalCounters();
+        std::vector<ScopeSummary>   Summaries();
+
+        // Clears global counters and scope summaries (not the per-thread counters)
+        void                        Reset();
+
+        // Logs every event to 'file' (nullptr, the default, turns it off)
+        void                        SetLog(std::FILE* file);
+
+        // Deep copies of at least 'bytes' are always logged, to stderr unless
+        // SetLog() chose another file. Default is 1MB; 0 turns it off.
+        void                        SetLargeCopyThreshold(const uint64_t bytes);
+
+        // Table of the global counters and every scope summary
+        void                        Report(std::ostream& os);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // UTF-8 <=> UTF-16 transcoding.
+    //
+    // All functions are length-driven (no terminator scan) and handle surrogate
+    // pairs and multi-byte sequences. Malformed input (lone surrogates, invalid
+    // or truncated UTF-8) is replaced by U+FFFD rather than rejected, which is
+    // what Excel itself does. Runs of ASCII are converted 16 units at a time
+    // with SSE2/NEON where available.
+    //
+    namespace Unicode
+    {
+        // Exact number of UTF-8 bytes needed to encode 'length' UTF-16 units
+        uint64_t    Utf8Length(const char16_t* str, const uint64_t length);
+
+        // Exact number of UTF-16 units needed to decode 'length' UTF-8 bytes
+        uint64_t    Utf16Length(const char* str, const uint64_t length);
+
+        // Encodes into 'out' (at least Utf8Length bytes). Returns bytes written.
+        uint64_t    ToUtf8(const char16_t* str, const uint64_t length, char* out);
+
+        // Decodes into 'out' (at least Utf16Length units, 'length' is always enough).
+        // Returns units written.
+        uint64_t    ToUtf16(const char* str, const uint64_t length, char16_t* out);
+    }
+
+
+    //
+    // A whole column of strings encoded as UTF-8 into one contiguous buffer.
+    // Entry i spans Bytes[Offsets[i], Offsets[i + 1]); cells that are not
+    // strings produce empty entries. This is the layout Arrow-style and most
+    // C++ text libraries accept directly.
+    //
+    struct Utf8Column
+    {
+        std::string             Bytes;
+        std::vector<uint64_t>   Offsets;
+
+        inline uint64_t         Size() const                            { return Offsets.empty() ? 0 : Offsets.size() - 1;  }
+        inline std::string_view operator[](const uint64_t index) const  { return std::string_view{Bytes}.substr(Offsets[index], Offsets[index + 1] - Offsets[index]); }
+    };
+
+
+    // Encodes every cell of a column (two passes: sizes, then one allocation and encode)
+    Utf8Column EncodeUtf8(StridedView<const Variant> column);
+    Utf8Column EncodeUtf8(const Array<Variant>& array, const uint64_t col);
+}
\ No newline at end of file
@@ -1,10 +1,31 @@
 #pragma once
 
 #include "MinXL/Core/Types.hpp"
+#include "MinXL/Core/Interface/Trace.hpp"
 
 
 namespace mxl
 {
+    //
+    // Excel error values, as the SCODEs Excel stores in a VT_ERROR Variant
+    // (what VBA's CVErr produces).
+    //
+    enum class CellError: int32_t
+    {
+        Null        = (int32_t)0x800A07D0,      // #NULL!
+        Div0        = (int32_t)0x800A07D7,      // #DIV/0!
+        Value       = (int32_t)0x800A07DF,      // #VALUE!
+        Ref         = (int32_t)0x800A07E7,      // #REF!
+        Name        = (int32_t)0x800A07ED,      // #NAME?
+        Num         = (int32_t)0x800A07F4,      // #NUM!
+        NA          = (int32_t)0x800A07FA,      // #N/A
+        GettingData = (int32_t)0x800A07FB       // #GETTING_DATA
+    };
+
+    // Text Excel displays for an error value (e.g. "#N/A")
+    const char* ErrorText(const CellError error);
+
+
     union VariantUnion
     {
         uint8_t         Byte;
@@ -21,6 +42,12 @@ namespace mxl
 
     class Variant
     {
+        template <ArrayValue> friend class Array;
+        friend struct Detail::SortCell;
+        friend struct Detail::VariantDispatch;
+        friend uint64_t Fingerprint(const Variant& value, const uint64_t seed);
+        template <ArrayValue _Ty> friend Array<_Ty>& PrepareOutput(Variant& target, const uint64_t rows, const uint64_t cols);
+
     private:
         Type::ID                _Type;
         uint8_t                 _ReservedMid[6];
@@ -33,7 +60,7 @@ namespace mxl
         
         // Variant <=> Variant
 
-        Variant(const Variant& other);
+        Variant(const Variant& other MXL_CALLER_PARAM);
         Variant(Variant&& other);
         Variant& operator=(const Variant& other);
         Variant& operator=(Variant&& other);
@@ -52,27 +79,49 @@ namespace mxl
 
         // Variant <=> Array
 
-        template <ArrayValue _Ty> Variant(const Array<_Ty>& array);
+        template <ArrayValue _Ty> Variant(const Array<_Ty>& array MXL_CALLER_PARAM);
         template <ArrayValue _Ty> Variant(Array<_Ty>&& array);
         template <ArrayValue _Ty> explicit operator Array<_Ty>() &&;
         template <ArrayValue _Ty> explicit operator Array<_Ty>() const &;
         template <ArrayValue _Ty> explicit operator Array<_Ty>&();
         template <ArrayValue _Ty> explicit operator const Array<_Ty>&() const;
 
+        // Array expression => Variant (materializes into a new Array)
+
+        template <ArrayExpression _Ex> Variant(const _Ex& expr);
+
         // Variant <=> Numeric
 
         template <Numeric _Ty> Variant(_Ty value);
         template <Numeric _Ty> explicit operator _Ty&();
         template <Numeric _Ty> explicit operator const _Ty&() const;
 
+        // Variant <=> VBA Boolean, Byte and Date
+
+        template <VbaScalar _Ty> Variant(_Ty value);
+        template <VbaScalar _Ty> explicit operator _Ty&();
+        template <VbaScalar _Ty> explicit operator const _Ty&() const;
+
+        // Variant <=> Excel error value
+
+        Variant(const CellError error);
+        CellError   Error() const;
+
         ~Variant();
 
+        // Non-throwing access by reference; a failure carries the message the
+        // conversion operators above would have thrown
+
+        template <VariantValue _Ty> Result<_Ty&>          TryAs();
+        template <VariantValue _Ty> Result<const _Ty&>    TryAs() const;
+
     public:
         Type::ID    TypeID() const;
         bool        IsEmpty() const;
         bool        IsNumeric() const;
         bool        IsString() const;
         bool        IsDate() const;
+        bool        IsError() const;
         bool        IsArray() const;
         Type::ID    ArrayTypeID() const;
         bool        IsArrayOfTypeID(Type::ID type) const;
@@ -80,12 +129,28 @@ namespace mxl
 
 
     private:
-        void Deallocate();
+        void        Deallocate();
+        uint64_t    PayloadBytes() const;
 
 
     public:
 
         // Variant <> Variant operators
+        //
+        // Operands are promoted as in VBA (Byte < Integer < Long < LongLong < Single < Double,
+        // Single next to Long or LongLong gives Double) and '/' always returns a floating
+        // point quotient. Empty acts as Integer 0, or as "" next to a String; a Boolean
+        // acts as Integer -1/0 and a Date as its Double serial. Integer results that
+        // would overflow widen to Double.
+        //
+        // As in a worksheet, failures are per cell rather than exceptions: an error
+        // operand is passed through (the left one if both are errors), dividing by
+        // zero or Empty gives #DIV/0! and arithmetic on text gives #VALUE!. Errors
+        // compare equal to the same error and unordered to anything else, Arrays
+        // included.
+        //
+        // The rest throws mxl::Exception: an Array operand next to anything but an
+        // error, and comparing text with a number, Boolean or Date.
 
         Variant     operator+(const Variant& other) const;
         Variant     operator-(const Variant& other) const;
@@ -128,22 +193,25 @@ namespace mxl
         Variant  operator--(int);
     };
 
-    // Primitive <> Variant operators
-
-    template<Numeric _Ty> _Ty  operator+(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty  operator-(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty  operator*(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty  operator/(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty& operator+=(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty& operator-=(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty& operator*=(_Ty value, const Variant& var);
-    template<Numeric _Ty> _Ty& operator/=(_Ty value, const Variant& var);
-    template<Numeric _Ty> bool operator==(const _Ty value, const Variant& var);
-    template<Numeric _Ty> bool operator!=(const _Ty value, const Variant& var);
-    template<Numeric _Ty> bool operator<(const _Ty value, const Variant& var);
-    template<Numeric _Ty> bool operator<=(const _Ty value, const Variant& var);
-    template<Numeric _Ty> bool operator>(const _Ty value, const Variant& var);
-    template<Numeric _Ty> bool operator>=(const _Ty value, const Variant& var);
+    // Primitive <> Variant operators; these go through the Variant tables just as
+    // Variant <> Primitive does. The compound forms store the result back into
+    // the primitive as the typed Array conversions would (integers round half to
+    // even and must fit), so an error or text result throws.
+
+    template<Numeric _Ty> Variant   operator+(const _Ty value, const Variant& var);
+    template<Numeric _Ty> Variant   operator-(const _Ty value, const Variant& var);
+    template<Numeric _Ty> Variant   operator*(const _Ty value, const Variant& var);
+    template<Numeric _Ty> Variant   operator/(const _Ty value, const Variant& var);
+    template<Numeric _Ty> _Ty&      operator+=(_Ty& value, const Variant& var);
+    template<Numeric _Ty> _Ty&      operator-=(_Ty& value, const Variant& var);
+    template<Numeric _Ty> _Ty&      operator*=(_Ty& value, const Variant& var);
+    template<Numeric _Ty> _Ty&      operator/=(_Ty& value, const Variant& var);
+    template<Numeric _Ty> bool      operator==(const _Ty value, const Variant& var);
+    template<Numeric _Ty> bool      operator!=(const _Ty value, const Variant& var);
+    template<Numeric _Ty> bool      operator<(const _Ty value, const Variant& var);
+    template<Numeric _Ty> bool      operator<=(const _Ty value, const Variant& var);
+    template<Numeric _Ty> bool      operator>(const _Ty value, const Variant& var);
+    template<Numeric _Ty> bool      operator>=(const _Ty value, const Variant& var);
 
 
     std::ostream& operator<<(std::ostream &os, const Variant& var);
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "MinXL/Core/Types.hpp"
+
+
+namespace mxl
+{
+    //
+    // Non-owning, one-dimensional view over elements spaced 'Stride' apart.
+    // Used for single columns (stride 1), single rows (stride = Rows()) and
+    // every-Nth selections of an mxl::Array. Use StridedView<const _Ty> for
+    // read-only access.
+    //
+    // Views never copy or free data; they must not outlive the Array they
+    // were taken from.
+    //
+    // Example:
+    // >>> for (auto& v : array.RowView(0))
+    // >>>     v *= 2;
+    //
+    template <ArrayValue _Ty>
+    class StridedView
+    {
+    private:
+        _Ty*        _Data;
+        uint64_t    _Size;
+        uint64_t    _Stride;
+
+    public:
+        //
+        // Holds an index rather than a pointer: one stride past the last element
+        // of a row or every-Nth view may lie beyond the end of the allocation,
+        // and forming such a pointer is undefined behaviour.
+        //
+        class Iterator
+        {
+            _Ty*        _Data;
+            int64_t     _Index;
+            int64_t     _Stride;
+
+        public:
+            using iterator_concept  = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = std::remove_const_t<_Ty>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = _Ty*;
+            using reference         = _Ty&;
+
+            Iterator();
+            Iterator(_Ty* data, int64_t index, int64_t stride);
+
+            reference   operator*() const;
+            pointer     operator->() const;
+            reference   operator[](difference_type n) const;
+
+            Iterator&   operator++();
+            Iterator    operator++(int);
+            Iterator&   operator--();
+            Iterator    operator--(int);
+            Iterator&   operator+=(difference_type n);
+            Iterator&   operator-=(difference_type n);
+            Iterator    operator+(difference_type n) const;
+            Iterator    operator-(difference_type n) const;
+
+            difference_type         operator-(const Iterator& other) const;
+            bool                    operator==(const Iterator& other) const;
+            std::strong_ordering    operator<=>(const Iterator& other) const;
+
+            friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+        };
+
+        using ValueType = _Ty;
+
+        StridedView();
+        StridedView(_Ty* data, uint64_t size, uint64_t stride);
+
+        template <ArrayValue _Other> requires Type::IsSame<_Other, _Ty> && std::is_const_v<_Ty>
+        StridedView(const StridedView<_Other>& other);
+
+    public:
+        _Ty&        operator[](const uint64_t index) const;
+
+        Iterator    begin() const;
+        Iterator    end() const;
+
+        inline auto Size() const        { return _Size;     }
+        inline auto Stride() const      { return _Stride;   }
+        inline auto Data() const        { return _Data;     }
+        inline bool IsContiguous() const { return _Stride == 1; }
+    };
+
+
+    //
+    // Non-owning view over a rectangular block of an mxl::Array. Elements are
+    // addressed as (row, col) relative to the block's top-left corner and
+    // iterated in column-major order, just like the Array itself.
+    //
+    template <ArrayValue _Ty>
+    class BlockView
+    {
+    private:
+        _Ty*        _Data;
+        uint64_t    _Rows;
+        uint64_t    _Columns;
+        uint64_t    _LeadingDim;
+
+    public:
+        class Iterator
+        {
+            _Ty*        _Data;
+            uint64_t    _Row;
+            uint64_t    _Column;
+            uint64_t    _Rows;
+            uint64_t    _LeadingDim;
+
+        public:
+            using iterator_concept  = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = std::remove_const_t<_Ty>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = _Ty*;
+            using reference         = _Ty&;
+
+            Iterator();
+            Iterator(_Ty* data, uint64_t row, uint64_t column, uint64_t rows, uint64_t leadingDim);
+
+            reference   operator*() const;
+            pointer     operator->() const;
+            Iterator&   operator++();
+            Iterator    operator++(int);
+            bool        operator==(const Iterator& other) const;
+        };
+
+        using ValueType = _Ty;
+
+        BlockView();
+        BlockView(_Ty* data, uint64_t rows, uint64_t cols, uint64_t leadingDim);
+
+        template <ArrayValue _Other> requires Type::IsSame<_Other, _Ty> && std::is_const_v<_Ty>
+        BlockView(const BlockView<_Other>& other);
+
+    public:
+        _Ty&                operator()(const uint64_t row, const uint64_t col) const;
+        StridedView<_Ty>    Column(const uint64_t col) const;
+        StridedView<_Ty>    Row(const uint64_t row) const;
+
+        Iterator            begin() const;
+        Iterator            end() const;
+
+        inline auto Rows() const        { return _Rows;                 }
+        inline auto Columns() const     { return _Columns;              }
+        inline auto Size() const        { return _Rows * _Columns;      }
+        inline auto LeadingDim() const  { return _LeadingDim;           }
+        inline auto Data() const        { return _Data;                 }
+    };
+}
\ No newline at end of file
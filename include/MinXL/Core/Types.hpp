@@ -5,6 +5,13 @@ namespace mxl
     class Variant;
     class String;
     struct StringContainer;
+    template <typename _Ty> class Result;
+
+    namespace Detail
+    {
+        struct SortCell;
+        struct VariantDispatch;
+    }
 
     namespace Type
     {
@@ -47,9 +54,51 @@ namespace mxl
     template <typename _Ty> concept Numeric = Type::IsNumeric<_Ty>;
 
 
-    // Valid Array value type (Supported numeric types + Variant)
-    template <typename _Ty> concept ArrayValue = Numeric<_Ty> || Type::IsSame<_Ty, Variant>;
+    //
+    // VBA Boolean: 2 bytes, True is stored as -1 (VARIANT_BOOL).
+    //
+    struct Bool
+    {
+        int16_t Value = 0;
+
+        constexpr Bool() = default;
+        constexpr Bool(const bool value): Value{value ? (int16_t)-1 : (int16_t)0} {}
+
+        constexpr operator bool() const     { return Value != 0; }
+    };
+
+
+    // VBA Byte
+    using Byte = uint8_t;
+
+
+    //
+    // VBA Date: days since 1899-12-30 as a double, the time of day being the
+    // fraction (OLE Automation date, the same serial Excel shows).
+    //
+    struct Date
+    {
+        double Value = 0.0;
+
+        constexpr Date() = default;
+        constexpr explicit Date(const double serial): Value{serial} {}
+
+        constexpr explicit operator double() const                  { return Value; }
+        constexpr auto operator<=>(const Date& other) const         = default;
+    };
+
+
+    // VBA scalar types stored natively, without Variant boxing
+    template <typename _Ty> concept VbaScalar = Type::IsSame<_Ty, Bool> || Type::IsSame<_Ty, Byte> || Type::IsSame<_Ty, Date>;
+
+
+    // Valid Array value type (Supported numeric types + VBA Boolean, Byte and Date + Variant)
+    template <typename _Ty> concept ArrayValue = Numeric<_Ty> || VbaScalar<_Ty> || Type::IsSame<_Ty, Variant>;
     template <ArrayValue _Ty> class Array;
+    template <ArrayValue _Ty> class StridedView;
+    template <ArrayValue _Ty> class BlockView;
+    template <ArrayValue _Ty> class BorrowedArray;
+    template <ArrayValue _Ty> class ArrayBuilder;
     struct ArrayHeader;
     struct ArrayBody;
 
@@ -73,7 +122,37 @@ namespace mxl
         inline constexpr bool IsArray = Detail::IsArrayType<_Ty>::value;
     }
 
-    template <typename _Ty> concept VariantValue    = Numeric<_Ty> || Type::IsSame<_Ty, String>     || Type::IsArray<_Ty>;
+    template <typename _Op, typename _Lhs, typename _Rhs> class BinaryExpression;
+    template <typename _Op, typename _Arg> class UnaryExpression;
+
+    namespace Type
+    {
+        namespace Detail
+        {
+            template <typename _Ty>
+            struct IsExpressionType: public std::false_type {};
+
+            template <typename _Op, typename _Lhs, typename _Rhs>
+            struct IsExpressionType<BinaryExpression<_Op, _Lhs, _Rhs>>: public std::true_type {};
+
+            template <typename _Op, typename _Arg>
+            struct IsExpressionType<UnaryExpression<_Op, _Arg>>: public std::true_type {};
+        }
+
+        //
+        // Check if type is a lazy Array expression. Ignores const.
+        //
+        template <typename _Ty>
+        inline constexpr bool IsExpression = Detail::IsExpressionType<std::remove_const_t<_Ty>>::value;
+    }
+
+    // Lazy element-wise expression over one or more Arrays
+    template <typename _Ty> concept ArrayExpression = Type::IsExpression<_Ty>;
+
+    // Anything that may appear as an operand of an Array expression
+    template <typename _Ty> concept ExpressionOperand = Numeric<_Ty> || Type::IsArray<_Ty> || Type::IsExpression<_Ty>;
+
+    template <typename _Ty> concept VariantValue    = Numeric<_Ty> || VbaScalar<_Ty> || Type::IsSame<_Ty, String> || Type::IsArray<_Ty>;
     template <typename _Ty> concept VariantValueRaw = Numeric<_Ty> || Type::IsSame<_Ty, char16_t*>  || Type::IsSame<_Ty, ArrayBody*>;
 
     template <typename _Fr, typename _To> concept Castable = requires { static_cast<_To>(_Fr{}); };
@@ -124,6 +203,12 @@ namespace mxl
                 return ID::Float; 
             if constexpr (IsSame<_Ty, double>)
                 return ID::Double;
+            if constexpr (IsSame<_Ty, Bool>)
+                return ID::Bool;
+            if constexpr (IsSame<_Ty, Byte>)
+                return ID::Byte;
+            if constexpr (IsSame<_Ty, Date>)
+                return ID::Date;
             if constexpr (IsSame<_Ty, String>)
                 return ID::String;
             if constexpr (IsSame<_Ty, Variant>)
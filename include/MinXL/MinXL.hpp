@@ -3,9 +3,43 @@
 #include "Core/Common.hpp"
 #include "Core/Types.hpp"
 
+#include "Core/Interface/Arena.hpp"
 #include "Core/Interface/Array.hpp"
+#include "Core/Interface/Borrowed.hpp"
+#include "Core/Interface/Builder.hpp"
+#include "Core/Interface/Cache.hpp"
+#include "Core/Interface/Dictionary.hpp"
+#include "Core/Interface/Expression.hpp"
+#include "Core/Interface/GroupBy.hpp"
+#include "Core/Interface/Incremental.hpp"
+#include "Core/Interface/Lookup.hpp"
+#include "Core/Interface/Output.hpp"
+#include "Core/Interface/Parallel.hpp"
+#include "Core/Interface/Profile.hpp"
+#include "Core/Interface/Result.hpp"
+#include "Core/Interface/Sort.hpp"
 #include "Core/Interface/String.hpp"
+#include "Core/Interface/Trace.hpp"
+#include "Core/Interface/Unicode.hpp"
 #include "Core/Interface/Variant.hpp"
+#include "Core/Interface/View.hpp"
+#include "Core/Implementation/Arena.hpp"
 #include "Core/Implementation/Array.hpp"
+#include "Core/Implementation/Borrowed.hpp"
+#include "Core/Implementation/Builder.hpp"
+#include "Core/Implementation/Cache.hpp"
+#include "Core/Implementation/Dictionary.hpp"
+#include "Core/Implementation/Expression.hpp"
+#include "Core/Implementation/GroupBy.hpp"
+#include "Core/Implementation/Incremental.hpp"
+#include "Core/Implementation/Lookup.hpp"
+#include "Core/Implementation/Output.hpp"
+#include "Core/Implementation/Parallel.hpp"
+#include "Core/Implementation/Profile.hpp"
+#include "Core/Implementation/Result.hpp"
+#include "Core/Implementation/Sort.hpp"
 #include "Core/Implementation/String.hpp"
-#include "Core/Implementation/Variant.hpp"
\ No newline at end of file
+#include "Core/Implementation/Trace.hpp"
+#include "Core/Implementation/Unicode.hpp"
+#include "Core/Implementation/Variant.hpp"
+#include "Core/Implementation/View.hpp"
\ No newline at end of file
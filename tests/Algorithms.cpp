@@ -0,0 +1,187 @@
+#include "Check.hpp"
+
+
+using namespace mxl;
+
+
+namespace
+{
+    double Number(const Variant& value)
+    {
+        return static_cast<const double&>(value);
+    }
+
+
+    const String& Text(const Variant& value)
+    {
+        return static_cast<const String&>(value);
+    }
+
+
+    void Sorting()
+    {
+        // Numbers first, then text ignoring case, then blanks, ties kept in order
+        Array<Variant> table(8, 2);
+        table(0, 0) = 3.0;
+        table(1, 0) = u"banana";
+        table(2, 0) = -1.0;
+        table(4, 0) = u"Apple";
+        table(5, 0) = (int32_t)2;
+        table(6, 0) = u"apple";
+        table(7, 0) = -0.0;
+
+        for (uint64_t i = 0; i < 8; i++)
+            table(i, 1) = (double)i;
+
+        CHECK((SortPermutation(table, {{0}}) == std::vector<uint64_t>{2, 7, 5, 0, 4, 6, 1, 3}));
+        CHECK((SortPermutation(table, {{0, SortOrder::Descending}}) == std::vector<uint64_t>{1, 4, 6, 0, 5, 7, 2, 3}));
+
+        const auto sorted = Sort(table);
+        CHECK(Number(sorted(0, 1)) == 2.0 && sorted(7, 0).IsEmpty());
+
+        Array<double> keys(6, 2);
+        const double first[] = {1, 0, 1, 0, 1, 0}, second[] = {5, 4, 3, 2, 1, 0};
+
+        for (uint64_t i = 0; i < 6; i++)
+        {
+            keys(i, 0) = first[i];
+            keys(i, 1) = second[i];
+        }
+
+        CHECK((SortPermutation(keys, {{0}, {1, SortOrder::Descending}}) == std::vector<uint64_t>{1, 3, 5, 0, 2, 4}));
+
+        // The parallel sort gives the same stable order
+        Array<int32_t> large(100000, 1);
+
+        for (uint64_t i = 0; i < large.Size(); i++)
+            large[i] = (int32_t)((i * 7919) % 2000) - 1000;
+
+        CHECK(SortPermutation(large.ColumnView(0), SortOrder::Ascending, false) == SortPermutation(large.ColumnView(0), SortOrder::Ascending, true));
+    }
+
+
+    void Lookup()
+    {
+        Array<Variant> keys(7, 1);
+        keys[0] = 1.0;
+        keys[1] = u"Apple";
+        keys[2] = (int32_t)7;
+        keys[3] = u"1";
+        keys[4] = u"APPLE";
+        keys[5] = -0.0;
+        keys[6] = Variant{CellError::NA};
+
+        const LookupIndex index{keys, 0};
+
+        // Numbers match across types, text ignores case, first match wins
+        CHECK(index.Find(Variant{1.0}) == 0 && index.Find((int16_t)1) == 0);
+        CHECK(index.Find(Variant{u"apple"}) == 1 && index.Find(Variant{u"1"}) == 3);
+        CHECK(index.Find(7.0) == 2 && index.Find(0.0) == 5);
+        CHECK(index.Find(Variant{}) == LookupIndex::NotFound);
+        CHECK(index.Find(Variant{u"pear"}) == LookupIndex::NotFound);
+
+        Array<Variant> values(7, 1);
+
+        for (uint64_t i = 0; i < 7; i++)
+            values[i] = i * 10.0;
+
+        Array<Variant> needles(3, 1);
+        needles[0] = u"APPle";
+        needles[1] = u"x";
+        needles[2] = Variant{CellError::Ref};
+
+        // Misses give #N/A, error needles are passed on
+        const auto gathered = index.Gather(needles.ColumnView(0), values);
+        CHECK(Number(gathered[0]) == 10);
+        CHECK(gathered[1].Error() == CellError::NA && gathered[2].Error() == CellError::Ref);
+    }
+
+
+    void Grouping()
+    {
+        Array<Variant> table(7, 2);
+        const char* regions[] = {"East", "west", "East", "West", nullptr, "east", "x"};
+
+        for (uint64_t i = 0; i < 7; i++)
+        {
+            if (regions[i])
+                table(i, 0) = Variant{regions[i]};
+
+            table(i, 1) = (double)(i + 1);
+        }
+
+        table(6, 1) = u"n/a";
+        table(3, 1) = Variant{CellError::NA};
+
+        const auto groups = GroupBy(table, {0}, {{1, Aggregate::Sum}, {1, Aggregate::Count}, {1, Aggregate::Mean}});
+
+        // Keys group ignoring case, in order of first appearance
+        CHECK(groups.Rows() == 4 && groups.Columns() == 4);
+        CHECK(Text(groups(0, 0)) == String{u"East"} && Number(groups(0, 1)) == 1 + 3 + 6 && Number(groups(0, 2)) == 3);
+        CHECK(groups(1, 1).Error() == CellError::NA);
+        CHECK(groups(2, 0).IsEmpty() && Number(groups(2, 1)) == 5);
+        CHECK(Number(groups(3, 1)) == 0 && Number(groups(3, 2)) == 1 && groups(3, 3).Error() == CellError::Div0);
+    }
+
+
+    void ParallelLoops()
+    {
+        Array<double> a(100000, 8);
+
+        ParallelFor(a, [&](uint64_t first, uint64_t last)
+        {
+            for (auto i = first; i < last; i++)
+                a[i] = i * 0.5;
+        }, 777);
+
+        bool filled = true;
+
+        for (uint64_t i = 0; i < a.Size(); i++)
+            filled &= a[i] == i * 0.5;
+
+        CHECK(filled);
+
+        auto sum = [&]
+        {
+            return ParallelReduce(a, 0.0, [&](uint64_t first, uint64_t last)
+            {
+                double partial = 0;
+
+                for (auto i = first; i < last; i++)
+                    partial += a[i];
+
+                return partial;
+            }, std::plus<>{});
+        };
+
+        // Same chunks, same combination order, same result
+        CHECK(sum() == sum());
+
+        std::atomic<uint64_t> columns{0};
+
+        ParallelForColumns(a, [&](uint64_t col)
+        {
+            columns += col;
+            ParallelFor(0, 5000, [](uint64_t, uint64_t) {}, 100);
+        });
+
+        CHECK(columns == 28);
+
+        CHECK_THROWS(ParallelFor(0, 10000, [](uint64_t first, uint64_t)
+        {
+            if (first == 5000)
+                MXL_THROW("Expected");
+        }, 100));
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Algorithms/Sorting",              Sorting},
+        {"Algorithms/Lookup",               Lookup},
+        {"Algorithms/Grouping",             Grouping},
+        {"Algorithms/ParallelLoops",        ParallelLoops},
+    });
+}
\ No newline at end of file
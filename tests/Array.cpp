@@ -0,0 +1,339 @@
+#include "Check.hpp"
+
+#include <numeric>
+
+
+using namespace mxl;
+
+
+namespace
+{
+    const String& Text(const Variant& value)
+    {
+        return static_cast<const String&>(value);
+    }
+
+
+    // Descriptor of the array a Variant holds, as the host would see it
+    ArrayBody& Body(Variant& value)
+    {
+        auto& array = static_cast<Array<double>&>(value);
+        return *reinterpret_cast<ArrayBody*>(reinterpret_cast<std::byte*>(&array) + sizeof(ArrayHeader));
+    }
+
+
+    void CensusUnboxAndBox()
+    {
+        Array<Variant> cells(5, 2);
+
+        for (uint64_t i = 0; i < cells.Size(); i++)
+            cells[i] = (double)i;
+
+        cells[3] = Variant{};
+        cells[4] = u"hi";
+        cells[5] = (int32_t)7;
+        cells[6] = Variant{Bool{true}};
+        cells[7] = Variant{Byte{9}};
+        cells[8] = Variant{Date{45000.5}};
+
+        const auto census = cells.Census();
+        CHECK(census.Empty == 1 && census.String == 1 && census.Double == 4);
+        CHECK(census.Numeric == 2 && census.Bool == 1 && census.Date == 1 && census.Other == 0);
+        CHECK(!census.AllNumeric() && census.HasEmpties() && census.HasStrings());
+
+        // Booleans, Bytes and Dates unbox the way typed conversions read them
+        const auto unboxed = cells.Unbox(UnboxPolicy::NaN);
+        CHECK(std::isnan(unboxed[3]) && std::isnan(unboxed[4]));
+        CHECK(unboxed[5] == 7 && unboxed[6] == -1 && unboxed[7] == 9 && unboxed[8] == 45000.5 && unboxed[9] == 9);
+        CHECK(cells.Unbox(UnboxPolicy::Zero)[4] == 0);
+        CHECK_THROWS(cells.Unbox(UnboxPolicy::Throw));
+
+        double values[10];
+
+        for (uint64_t i = 0; i < 10; i++)
+            values[i] = i * 1.5;
+
+        cells.Box(values);
+        CHECK(cells.Census().AllDouble());
+        CHECK(static_cast<const double&>(cells[9]) == 13.5);
+    }
+
+
+    void Copies()
+    {
+        Array<Variant> a(7, 1);
+        a[0] = 1.0;
+        a[1] = u"hello";
+        a[2] = Variant{CellError::NA};
+        a[5] = Variant{Array<double>(2, 2)};
+
+        // Strings and nested arrays are deep copied
+        Array<Variant> b{a};
+        CHECK(Text(b[1]) == String{u"hello"} && Text(b[1]).Buffer() != Text(a[1]).Buffer());
+        CHECK(b[2].Error() == CellError::NA && b[4].IsEmpty());
+        CHECK(static_cast<const Array<double>&>(b[5]).Data() != static_cast<const Array<double>&>(a[5]).Data());
+
+        Array<Variant> c(2, 1);
+        c[0] = u"replaced";
+        c = a;
+        CHECK(c.Rows() == 7 && Text(c[1]) == String{u"hello"});
+
+        c = std::move(b);
+        CHECK(c.Rows() == 7 && b.Data() == nullptr);
+
+        Variant wrapped{a};
+        Variant copy{wrapped};
+        CHECK(static_cast<const Array<Variant>&>(copy).Rows() == 7);
+
+        // Copies take the caller's location only when tracing is compiled in
+        CHECK((std::is_constructible_v<Array<double>, const Array<double>&, std::source_location>) == Trace::Enabled);
+        CHECK((std::is_constructible_v<Variant, const Variant&, std::source_location>) == Trace::Enabled);
+    }
+
+
+    void TypedConversions()
+    {
+        Array<Variant> cells(4, 1);
+        cells[0] = 1.0;
+        cells[1] = Variant{Bool{true}};
+        cells[2] = (int32_t)0;
+
+        Array<Bool> flags{cells};
+        CHECK(flags[0] && flags[1] && !flags[2] && !flags[3]);
+
+        // Integers round half to even, as CInt does
+        Array<Variant> halves(2, 1);
+        halves[0] = 2.5;
+        halves[1] = 3.5;
+
+        Array<int16_t> rounded{halves};
+        CHECK(rounded[0] == 2 && rounded[1] == 4);
+
+        // True is -1, which doesn't fit a Byte; text doesn't convert at all
+        CHECK_THROWS(Array<Byte>{cells});
+        cells[3] = u"x";
+        CHECK_THROWS(Array<Date>{cells});
+
+        Array<Date> dates(2, 1);
+        dates[0] = Date{45000.5};
+
+        Array<Variant> boxed{dates};
+        CHECK(boxed[0].IsDate() && Array<double>{boxed}[0] == 45000.5);
+    }
+
+
+    void ResizeAndBuilder()
+    {
+        Array<double> a(3, 2);
+
+        for (uint64_t i = 0; i < 6; i++)
+            a[i] = (double)i;
+
+        a.Resize(3, 4);
+        CHECK(a(2, 1) == 5 && a(2, 3) == 0);
+        a.Resize(10, 1);
+        CHECK(a(2, 0) == 2 && a(9, 0) == 0);
+        a(0, 0) = 7;
+        a.Resize(4, 4);
+        CHECK(a(0, 0) == 7 && a(3, 3) == 0);
+
+        Array<Variant> v(2, 2);
+        v(0, 0) = u"a";
+        v(1, 1) = u"b";
+        v.Resize(1, 3);
+        CHECK(v.Rows() == 1 && Text(v(0, 0)) == String{u"a"} && v(0, 2).IsEmpty());
+
+        ArrayBuilder<Variant> builder{2};
+
+        for (int i = 0; i < 1000; i++)
+            builder.AppendRow((double)i, u"x");
+
+        builder.Append(5.0);
+        CHECK(builder.Rows() == 1001);
+
+        auto built = builder.Finish();
+        CHECK(built.Rows() == 1001 && built.Columns() == 2);
+        CHECK(built(999, 0) == 999.0 && Text(built(999, 1)) == String{u"x"});
+        CHECK(built(1000, 0) == 5.0 && built(1000, 1).IsEmpty());
+
+        ArrayBuilder<double> partial{3};
+        partial.Append(1.0);
+        CHECK_THROWS(partial.AppendRow(1.0, 2.0, 3.0));
+    }
+
+
+    void Transposes()
+    {
+        for (auto [rows, cols] : {std::pair<uint64_t, uint64_t>{1, 1}, {3, 5}, {33, 65}, {129, 31}, {0, 3}})
+        {
+            Array<double> a(rows, cols);
+
+            for (uint64_t i = 0; i < a.Size(); i++)
+                a[i] = (double)i;
+
+            std::vector<double> rowMajor(a.Size());
+            a.ToRowMajor(rowMajor.data());
+
+            bool matches = true;
+
+            for (uint64_t r = 0; r < rows; r++)
+            {
+                for (uint64_t c = 0; c < cols; c++)
+                    matches &= rowMajor[r * cols + c] == a(r, c);
+            }
+
+            Array<double> back(rows, cols);
+            back.FromRowMajor(rowMajor.data());
+
+            const auto transposed = a.Transposed();
+
+            CHECK(matches);
+            CHECK(std::equal(a.Data(), a.Data() + a.Size(), back.Data()));
+            CHECK(transposed.Rows() == cols && transposed.Columns() == rows);
+            CHECK(!a.Size() || transposed(cols - 1, 0) == a(0, cols - 1));
+        }
+
+        Array<Variant> square(3, 3);
+        square(0, 2) = u"x";
+        square.Transpose();
+        CHECK(Text(square(2, 0)) == String{u"x"});
+
+        CHECK_THROWS(Array<double>(2, 3).Transpose());
+    }
+
+
+    void Views()
+    {
+        Array<double> a(4, 3);
+
+        for (uint64_t i = 0; i < a.Size(); i++)
+            a[i] = (double)i;
+
+        auto column = a.ColumnView(1);
+        CHECK(column.Size() == 4 && column[0] == 4 && column.IsContiguous());
+
+        auto row = a.RowView(2);
+        CHECK(row.Size() == 3 && row[2] == 10 && row.Stride() == 4);
+        CHECK(std::accumulate(row.begin(), row.end(), 0.0) == 2 + 6 + 10);
+        CHECK(row.end() - row.begin() == 3);
+
+        std::sort(row.begin(), row.end(), std::greater<>{});
+        CHECK(a(2, 0) == 10 && a(2, 2) == 2);
+
+        auto block = a.Block(1, 1, 2, 2);
+        CHECK(std::distance(block.begin(), block.end()) == 4);
+        CHECK(block(0, 0) == 5 && block.Column(1)[1] == a(2, 2));
+        CHECK_THROWS(a.Block(3, 0, 2, 1));
+
+        auto every = a.EveryNth(5);
+        CHECK(every.Size() == 3 && every[2] == a[10]);
+
+        // An offset past the end is an empty view, not an out-of-range pointer
+        auto past = a.EveryNth(2, 20);
+        CHECK(past.Size() == 0 && past.begin() == past.end());
+    }
+
+
+    void PrepareOutputReuse()
+    {
+        Variant out;
+
+        auto& first = PrepareOutput<double>(out, 10, 2);
+        first(9, 1) = 3;
+
+        auto& again = PrepareOutput<double>(out, 10, 2);
+        CHECK(again.Data() == first.Data() && again(9, 1) == 3);
+
+        auto& smaller = PrepareOutput<double>(out, 5, 2);
+        CHECK(smaller.Rows() == 5 && smaller(4, 1) == 0);
+
+        // Host arrays that can't be freed are filled in place or refused
+        Body(out).Features |= (uint16_t)ArrayFeatures::FixedSize;
+        CHECK(PrepareOutput<double>(out, 5, 2).Rows() == 5);
+        CHECK_THROWS(PrepareOutput<double>(out, 6, 2));
+        CHECK_THROWS(PrepareOutput<Variant>(out, 5, 2));
+        Body(out).Features &= ~(uint16_t)ArrayFeatures::FixedSize;
+
+        Body(out).Locks = 1;
+        CHECK_THROWS(PrepareOutput<double>(out, 6, 2));
+        Body(out).Locks = 0;
+
+        CHECK(PrepareOutput<double>(out, 6, 2).Rows() == 6);
+    }
+
+
+    void BorrowedWrites()
+    {
+        Array<Variant> source(10000, 1);
+
+        for (uint64_t i = 0; i < source.Size(); i++)
+            source[i] = (double)i;
+
+        const Variant argument{source};
+
+        BorrowedArray<Variant> borrowed{argument};
+        borrowed.Write(5) = -1.0;
+
+        CHECK(borrowed.CopiedBlocks() == 1 && borrowed.IsCopied(5, 0) && !borrowed.IsCopied(5000, 0));
+        CHECK(static_cast<const double&>(borrowed[5]) == -1.0);
+        CHECK(static_cast<const double&>(static_cast<const Array<Variant>&>(argument)[5]) == 5.0);
+
+        const auto materialized = borrowed.Materialize();
+        CHECK(materialized[5] == -1.0 && materialized[9999] == 9999.0);
+    }
+
+
+    void Expressions()
+    {
+        Array<double> a(4, 3), b(4, 3);
+
+        for (uint64_t i = 0; i < a.Size(); i++)
+        {
+            a[i] = (double)i;
+            b[i] = 2;
+        }
+
+        Array<double> r = a * b + 1.0;
+        CHECK(r[5] == 11);
+
+        Array<Variant> v(4, 3);
+
+        for (auto& cell : v)
+            cell = 1.0;
+
+        Array<Variant> mixed = v * 2.0 + a;
+        CHECK(static_cast<const double&>(mixed[3]) == 5);
+
+        CHECK_THROWS(Array<double>{a + Array<double>(2, 5)});
+
+        // Integers divide as doubles, so a zero divisor is inf rather than a trap
+        Array<int32_t> n(3, 1), d(3, 1);
+        n[0] = 1;   n[1] = 7;   n[2] = -7;
+        d[0] = 0;   d[1] = 2;   d[2] = 2;
+
+        Array<double> q = n / d;
+        CHECK(std::isinf(q[0]) && q[1] == 3.5 && q[2] == -3.5);
+
+        // ... and truncates back into an integer Array only when it fits
+        CHECK_THROWS(Array<int32_t>{n / d});
+        d[0] = 4;
+        Array<int32_t> t = n / d;
+        CHECK(t[0] == 0 && t[1] == 3 && t[2] == -3);
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Array/CensusUnboxAndBox",         CensusUnboxAndBox},
+        {"Array/Copies",                    Copies},
+        {"Array/TypedConversions",          TypedConversions},
+        {"Array/ResizeAndBuilder",          ResizeAndBuilder},
+        {"Array/Transposes",                Transposes},
+        {"Array/Views",                     Views},
+        {"Array/PrepareOutput",             PrepareOutputReuse},
+        {"Array/BorrowedWrites",            BorrowedWrites},
+        {"Array/Expressions",               Expressions},
+    });
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <MinXL/MinXL.hpp>
+
+
+// Records a failed expectation and carries on, so one run reports all of them
+#define CHECK(expr)         test::Check((expr), #expr, __FILE__, __LINE__)
+#define CHECK_THROWS(expr)  test::Check(test::Throws([&] { (void)(expr); }), "throws: " #expr, __FILE__, __LINE__)
+
+
+namespace test
+{
+    struct Case
+    {
+        const char*     Name;
+        void            (*Body)();
+    };
+
+
+    inline uint64_t& Failures()
+    {
+        static uint64_t failures = 0;
+        return failures;
+    }
+
+
+    inline void Check(const bool passed, const char* expr, const char* file, const int line)
+    {
+        if (passed)
+            return;
+
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+        Failures()++;
+    }
+
+
+    template <typename _Fn>
+    inline bool Throws(_Fn&& body)
+    {
+        try
+        {
+            body();
+        }
+        catch (const mxl::Exception&)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+
+    //
+    // Runs every case, reporting an escaping exception as a failure of that
+    // case. Returns the process exit code.
+    //
+    inline int Run(std::initializer_list<Case> cases)
+    {
+        for (auto& testCase : cases)
+        {
+            const uint64_t before = Failures();
+
+            try
+            {
+                testCase.Body();
+            }
+            catch (const std::exception& e)
+            {
+                std::fprintf(stderr, "%s: unexpected exception: %s\n", testCase.Name, e.what());
+                Failures()++;
+            }
+
+            std::printf("%-40s %s\n", testCase.Name, Failures() == before ? "ok" : "FAILED");
+        }
+
+        return Failures() ? 1 : 0;
+    }
+}
\ No newline at end of file
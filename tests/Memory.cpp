@@ -0,0 +1,192 @@
+#include "Check.hpp"
+
+#include <thread>
+
+
+using namespace mxl;
+
+
+namespace
+{
+    double Number(const Variant& value)
+    {
+        return static_cast<const double&>(value);
+    }
+
+
+    void ArenaScopes()
+    {
+        Variant result;
+
+        {
+            ArenaScope arena;
+
+            Array<double> scratch(100, 3);
+            CHECK(arena.Get().Owns(scratch.Data()));
+
+            Array<Variant> out(100, 1);
+            out[0] = u"kept";
+            out[1] = 2.0;
+
+            // Promoted values leave the arena before it is rewound
+            result = arena.Promote(Variant{std::move(out)});
+        }
+
+        CHECK(!Detail::IsArenaBacked(result));
+
+        const auto& array = static_cast<const Array<Variant>&>(result);
+        CHECK(static_cast<const String&>(array[0]) == String{u"kept"} && Number(array[1]) == 2.0);
+    }
+
+
+    void ArenaOwnership()
+    {
+        ArenaScope arena;
+
+        void* small = Detail::Malloc(100);
+        void* oversized = Detail::Malloc(5 << 20);
+        void* heap = std::malloc(10);
+
+        // Asked from another thread, which has no arena of its own
+        bool smallOwned = false, oversizedOwned = false, heapOwned = true;
+
+        std::thread{[&]
+        {
+            smallOwned = Detail::IsArenaMemory(small);
+            oversizedOwned = Detail::IsArenaMemory((char*)oversized + (4 << 20));
+            heapOwned = Detail::IsArenaMemory(heap);
+        }}.join();
+
+        CHECK(smallOwned && oversizedOwned && !heapOwned);
+        std::free(heap);
+
+        // count * size overflowing 64 bits fails instead of wrapping (volatile
+        // keeps the compiler from flagging the constant product)
+        volatile uint64_t count = UINT64_MAX / 2;
+        CHECK(Detail::Calloc(count, 4) == nullptr);
+    }
+
+
+    void ResultCacheEviction()
+    {
+        ResultCache cache{4096};
+        uint64_t runs = 0;
+
+        auto compute = [&]
+        {
+            runs++;
+            return Variant{u"result"};
+        };
+
+        const auto key = Fingerprints(Variant{1.0}, Variant{u"argument"});
+
+        cache.GetOrCompute(1, key, compute);
+        const auto hit = cache.GetOrCompute(1, key, compute);
+        CHECK(runs == 1 && static_cast<const String&>(hit) == String{u"result"});
+
+        cache.GetOrCompute(2, key, compute);
+        CHECK(runs == 2);
+
+        // Entries holding strings are evicted to stay within the budget
+        for (uint64_t i = 0; i < 50; i++)
+        {
+            Array<Variant> strings(20, 1);
+
+            for (auto& cell : strings)
+                cell = u"some cached text";
+
+            cache.Insert(100, {i}, Variant{strings});
+        }
+
+        CHECK(cache.BytesUsed() <= 4096 && cache.Stats().Evictions > 0);
+        CHECK(cache.Find(100, {49}) && !cache.Find(100, {0}));
+
+        cache.Insert(5, {}, Variant{Array<double>(1000, 1)});
+        CHECK(!cache.Find(5, {}));
+    }
+
+
+    void IncrementalUpdates()
+    {
+        const uint64_t rows = 1000;
+        uint64_t computed = 0;
+
+        auto kernel = [&](const Array<Variant>& input, const std::vector<uint64_t>& changed, Array<Variant>& patch)
+        {
+            computed += changed.size();
+
+            for (uint64_t i = 0; i < changed.size(); i++)
+                patch(i, 0) = Number(input(changed[i], 0)) * 2;
+        };
+
+        Array<Variant> input(rows, 1);
+
+        for (uint64_t i = 0; i < rows; i++)
+            input[i] = (double)i;
+
+        IncrementalCache cache;
+
+        CHECK(Number(cache.Update(7, input, 1, kernel)(5, 0)) == 10 && computed == rows);
+
+        // Only the changed rows are recomputed
+        Array<Variant> edited{input};
+        edited[123] = 1.0;
+
+        computed = 0;
+        const auto output = cache.Update(7, edited, 1, kernel);
+        CHECK(computed == 1 && Number(output(123, 0)) == 2 && Number(output(5, 0)) == 10);
+
+        // An empty input still replaces the entry, with the requested width
+        const auto empty = cache.Update(7, Array<Variant>(0, 1), 2, kernel);
+        CHECK(empty.Rows() == 0 && empty.Columns() == 2);
+
+        computed = 0;
+        cache.Update(7, input, 1, kernel);
+        CHECK(computed == rows);
+    }
+
+
+    // A VT_CY cell as the host hands it over; MinXL has no Currency type of its own
+    Variant Currency(const int64_t value)
+    {
+        Variant cell;
+        const uint16_t type = 0x0006;
+
+        std::memcpy(reinterpret_cast<std::byte*>(&cell), &type, sizeof(type));
+        std::memcpy(reinterpret_cast<std::byte*>(&cell) + 8, &value, sizeof(value));
+        return cell;
+    }
+
+
+    void UnhashedValues()
+    {
+        // Only the type tag of these could be hashed, so they get no fingerprint
+        CHECK_THROWS(Fingerprint(Currency(10000)));
+
+        Array<Variant> nested(2, 1);
+        nested[0] = 1.0;
+        nested[1] = Currency(10000);
+        CHECK_THROWS(Fingerprints(Variant{1.0}, Variant{nested}));
+
+        // ... and rows holding them always count as changed
+        Array<Variant> previous(2, 1), current(2, 1);
+        previous[0] = Variant{nested};
+        current[0] = Variant{nested};
+        previous[1] = Variant{Array<double>(3, 1)};
+        current[1] = Variant{Array<double>(3, 1)};
+
+        CHECK(ChangedRows(previous, current) == std::vector<uint64_t>{0});
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Memory/ArenaScopes",              ArenaScopes},
+        {"Memory/ArenaOwnership",           ArenaOwnership},
+        {"Memory/ResultCacheEviction",      ResultCacheEviction},
+        {"Memory/IncrementalUpdates",       IncrementalUpdates},
+        {"Memory/UnhashedValues",           UnhashedValues},
+    });
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "Check.hpp"
+
+#include <thread>
+
+
+using namespace mxl;
+
+
+namespace
+{
+    void Buckets()
+    {
+        using Detail::ProfileBucket;
+        using Detail::ProfileBucketValue;
+
+        // Exact below 16, then 16 sub-buckets per power of two
+        CHECK(ProfileBucket(0) == 0 && ProfileBucket(15) == 15);
+        CHECK(ProfileBucket(16) == 16 && ProfileBucket(31) == 31);
+        CHECK(ProfileBucket(32) == 32 && ProfileBucket(33) == 32 && ProfileBucket(34) == 33);
+        CHECK(ProfileBucket(UINT64_MAX) == Profile::Buckets - 1);
+        CHECK(ProfileBucketValue(15) == 15 && ProfileBucketValue(32) == 33);
+
+        // A bucket's value falls back into it, within 1/16 of what was recorded
+        const uint64_t samples[] = {16, 31, 32, 33, 1000, 123456789, 1ull << 40, UINT64_MAX};
+
+        for (const uint64_t ns : samples)
+        {
+            const auto bucket = ProfileBucket(ns);
+            const auto value = ProfileBucketValue(bucket);
+
+            CHECK(ProfileBucket(value) == bucket);
+            CHECK((double)(value > ns ? value - ns : ns - value) <= ns / 16.0);
+        }
+
+        bool increasing = true;
+
+        for (uint32_t b = 1; b < Profile::Buckets; b++)
+            increasing &= ProfileBucketValue(b - 1) < ProfileBucketValue(b) && ProfileBucket(ProfileBucketValue(b)) == b;
+
+        CHECK(increasing);
+    }
+
+
+    void Call(const Variant& argument, const bool slow)
+    {
+        MXL_PROFILE("Profile/Call", Profile::Cells(argument));
+
+        if (slow)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+
+    void SnapshotAndTable()
+    {
+        Profile::Reset();
+
+        const Variant range{Array<double>(3, 4)};
+
+        for (int i = 0; i < 99; i++)
+            Call(range, false);
+
+        std::thread{[&] { Call(Variant{1.0}, true); }}.join();
+
+        // Threads are merged; 99 of 100 calls are fast
+        const auto stats = Profile::Snapshot();
+        CHECK(stats.size() == 1 && stats[0].Name == "Profile/Call");
+        CHECK(stats[0].Calls == 100 && stats[0].Cells == 99 * 12 + 1);
+        CHECK(stats[0].MaxNs >= 5000000 && stats[0].TotalNs >= stats[0].MaxNs);
+        CHECK(stats[0].P50Ns <= stats[0].P90Ns && stats[0].P90Ns <= stats[0].P99Ns && stats[0].P99Ns < 5000000);
+
+        const auto table = Profile::Table();
+        CHECK(table.Rows() == 2 && table.Columns() == 11);
+        CHECK(static_cast<const String&>(table(0, 0)) == String{"Entry"});
+        CHECK(static_cast<const String&>(table(1, 0)) == String{"Profile/Call"});
+        CHECK(static_cast<const double&>(table(1, 1)) == 100 && static_cast<const double&>(table(1, 8)) >= 5000);
+
+        std::ostringstream dump;
+        Profile::Dump(dump);
+        CHECK(dump.str().find("Profile/Call") != std::string::npos);
+
+        // Entry points stay registered but drop out of the table until called again
+        Profile::Reset();
+        CHECK(Profile::Snapshot().empty() && Profile::Table().Rows() == 1);
+        CHECK(Profile::Register("Profile/Call") == Profile::Register("Profile/Call"));
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Profile/Buckets",                 Buckets},
+        {"Profile/SnapshotAndTable",        SnapshotAndTable},
+    });
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "Check.hpp"
+
+#include <unordered_set>
+
+
+using namespace mxl;
+
+
+namespace
+{
+    // "héllo € 😀 end": two, three and four byte sequences
+    constexpr const char* Mixed = "h\xC3\xA9llo \xE2\x82\xAC \xF0\x9F\x98\x80 end";
+
+
+    void Utf8RoundTrip()
+    {
+        const String text{Mixed};
+
+        CHECK(text.Size() == 14);
+        CHECK(text.Buffer()[1] == 0xE9 && text.Buffer()[6] == 0x20AC);
+        CHECK(text.Buffer()[8] == 0xD83D && text.Buffer()[9] == 0xDE00);
+        CHECK(text.Utf8() == Mixed);
+        CHECK(std::string{text.CStr().get()} == Mixed);
+
+        // Long enough for the vector paths, with a non-ASCII character past them
+        std::string ascii;
+
+        for (int i = 0; i < 1000; i++)
+            ascii += char('a' + i % 26);
+
+        ascii += "\xC3\xA9" + std::string(37, 'z');
+
+        const String longText{ascii};
+        CHECK(longText.Size() == 1038 && longText.Utf8() == ascii);
+
+        CHECK(String{""}.Size() == 0 && String{}.Utf8().empty());
+    }
+
+
+    void InvalidSequences()
+    {
+        // Overlong, surrogate and out of range sequences each become U+FFFD
+        const String bad{std::string_view{"a\xC0\xAF" "b\xE0\x80z\xED\xA0\x80\xF4\x90\x80\x80" "c\xE2\x82"}};
+        const std::u16string decoded{bad.Buffer(), bad.Size()};
+
+        CHECK(decoded == u"a��b��z�������c�");
+
+        const char16_t lone[] = {u'x', 0xD800, u'y', 0xDC00, 0};
+        CHECK(String{lone}.Utf8() == "x\xEF\xBF\xBDy\xEF\xBF\xBD");
+    }
+
+
+    void EqualityOrderingAndHash()
+    {
+        const String apple{"apple"}, apples{"apples"}, upper{"APPLE"}, banana{"banana"};
+
+        CHECK(apple != apples && apple < apples && apples < banana && upper < apple);
+        CHECK(apple.Equals(upper, CaseSensitivity::Insensitive));
+        CHECK(apple.Compare(upper, CaseSensitivity::Insensitive) == 0);
+        CHECK(apple.Hash(CaseSensitivity::Insensitive) == upper.Hash(CaseSensitivity::Insensitive));
+        CHECK(apple.Hash() != upper.Hash());
+
+        // Case folding beyond ASCII
+        CHECK(String{"\xC3\x89T\xC3\x89"}.Equals(String{"\xC3\xA9t\xC3\xA9"}, CaseSensitivity::Insensitive));
+
+        CHECK(String{""} == String{} && !(String{""} < String{}));
+
+        const std::unordered_set<String> set{apple, apples, upper, apple};
+        CHECK(set.size() == 3);
+
+        CHECK(Variant{u"abc"} < Variant{u"abd"});
+    }
+
+
+    void PoolAndDictionary()
+    {
+        Array<Variant> table(6, 1);
+        const char* values[] = {"a", "b", "a", nullptr, "b", "a"};
+
+        for (uint64_t i = 0; i < 6; i++)
+        {
+            if (values[i])
+                table[i] = Variant{values[i]};
+        }
+
+        table[3] = 1.0;
+
+        StringPool pool;
+        DictionaryColumn column{pool, table, 0};
+
+        CHECK(pool.Size() == 2);
+        CHECK(column[0] == column[2] && column[0] != column[1]);
+        CHECK(column[3] == DictionaryColumn::Missing);
+        CHECK(column.Histogram()[0] == 3);
+        CHECK(column.Match(String{"b"}).size() == 2);
+        CHECK(*column.Decode(1) == String{"b"});
+        CHECK(pool.Find(String{"zz"}) == StringPool::NotFound);
+
+        const auto encoded = EncodeUtf8(table, 0);
+        CHECK(encoded.Size() == 6 && encoded[0] == "a" && encoded[3].empty());
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Strings/Utf8RoundTrip",           Utf8RoundTrip},
+        {"Strings/InvalidSequences",        InvalidSequences},
+        {"Strings/EqualityOrderingAndHash", EqualityOrderingAndHash},
+        {"Strings/PoolAndDictionary",       PoolAndDictionary},
+    });
+}
\ No newline at end of file
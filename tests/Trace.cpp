@@ -0,0 +1,189 @@
+#include "Check.hpp"
+
+#include <thread>
+
+
+using namespace mxl;
+
+
+namespace
+{
+    void ScopeDeltas()
+    {
+        Array<Variant> a(10, 1);
+
+        for (uint64_t i = 0; i < a.Size(); i++)
+            a[i] = (double)i;
+
+        Trace::Scope scope{"Trace/Copy"};
+
+        {
+            Array<Variant> b{a};
+
+            const auto counters = scope.Current();
+            CHECK(counters.DeepCopies == 1 && counters.BytesCopied == 10 * sizeof(Variant));
+            CHECK(counters.Allocations == 1 && counters.LiveBytes == (int64_t)counters.BytesAllocated);
+        }
+
+        // Moves hand the buffer over without copying it
+        Array<Variant> c{a};
+        Array<Variant> d{std::move(c)};
+
+        const auto counters = scope.Current();
+        CHECK(counters.DeepCopies == 2 && counters.Deallocations == 1);
+        CHECK(counters.Moves == 1 && counters.BytesMoved == 10 * sizeof(Variant));
+        CHECK(Trace::Scope::Active() == &scope);
+    }
+
+
+    void PeakRestore()
+    {
+        Trace::Scope outer{"Trace/Outer"};
+
+        {
+            Trace::Scope inner{"Trace/Inner"};
+            Array<double> big(1000, 1);
+
+            CHECK(inner.Current().PeakBytes >= 8000 && Trace::Scope::Active() == &inner);
+        }
+
+        // The inner peak still counts for the outer scope once it is freed
+        CHECK(outer.Current().PeakBytes >= 8000 && outer.Current().LiveBytes == 0);
+
+        {
+            // Each scope measures its own high-water mark from where it started
+            Trace::Scope inner{"Trace/Inner"};
+            Array<double> small(10, 1);
+
+            CHECK(inner.Current().PeakBytes < 8000);
+        }
+
+        CHECK(Trace::Scope::Active() == &outer);
+
+        bool found = false;
+
+        for (auto& summary : Trace::Summaries())
+        {
+            if (summary.Name == "Trace/Inner")
+            {
+                found = true;
+                CHECK(summary.Calls == 2 && summary.Totals.PeakBytes >= 8000 && summary.Totals.LiveBytes == 0);
+            }
+        }
+
+        CHECK(found);
+    }
+
+
+    void CallSites()
+    {
+        Array<Variant> a(4, 1);
+        a[0] = u"text";
+
+        std::FILE* log = std::tmpfile();
+        Trace::SetLog(log);
+
+        const Array<Variant> b{a};
+        const uint32_t line = __LINE__ - 1;
+
+        Trace::SetLog(nullptr);
+
+        std::string text(4096, '\0');
+        std::rewind(log);
+        text.resize(std::fread(text.data(), 1, text.size(), log));
+        std::fclose(log);
+
+        // The copy, its string and its allocations are all reported at this line
+        const std::string site = "Trace.cpp, line " + std::to_string(line);
+
+        CHECK(text.find("DeepCopy") != std::string::npos && text.find(site) != std::string::npos);
+        CHECK(text.find(".hpp") == std::string::npos);
+
+        CHECK((std::is_constructible_v<Array<double>, const Array<double>&, std::source_location>));
+    }
+
+
+    void ReleasedCells()
+    {
+        Trace::Scope scope{"Trace/Release"};
+
+        {
+            Array<Variant> strings(20, 1);
+
+            for (auto& cell : strings)
+                cell = u"some cached text";
+
+            // Evicted copies give back their strings along with the cells
+            ResultCache cache{4096};
+
+            for (uint64_t i = 0; i < 10; i++)
+                cache.Insert(1, {i}, Variant{strings});
+
+            CHECK(cache.Stats().Evictions > 0);
+
+            // Assignments release the buffer they replace
+            Array<Variant> other(5, 1);
+            other[0] = u"replaced";
+            other = strings;
+            other = Array<Variant>(3, 1);
+
+            // Moving out of a Variant frees the descriptor it allocated
+            Variant boxed{strings};
+            const auto unboxed = static_cast<Array<Variant>>(std::move(boxed));
+            CHECK(unboxed.Rows() == 20);
+        }
+
+        CHECK(scope.Current().LiveBytes == 0);
+    }
+
+
+    void GlobalCounters()
+    {
+        Trace::Reset();
+        CHECK(Trace::Summaries().empty());
+
+        const auto before = Trace::ThreadCounters();
+
+        Trace::Record(Trace::Event::Allocate, 100, "here");
+        Trace::Record(Trace::Event::Allocate, 50, "here");
+        Trace::Record(Trace::Event::Deallocate, 100, "here");
+        Trace::Record(Trace::Event::Move, 0, "here");
+
+        // Other threads show up in the global counters, not in this thread's
+        std::thread{[]
+        {
+            Trace::Record(Trace::Event::DeepCopy, 30, "there");
+        }}.join();
+
+        const auto global = Trace::GlobalCounters();
+        CHECK(global.Allocations == 2 && global.Deallocations == 1 && global.BytesAllocated == 150);
+        CHECK(global.LiveBytes == 50 && global.PeakBytes == 150);
+        CHECK(global.DeepCopies == 1 && global.BytesCopied == 30 && global.Moves == 0);
+
+        const auto thread = Trace::ThreadCounters();
+        CHECK(thread.Allocations - before.Allocations == 2 && thread.DeepCopies == before.DeepCopies);
+
+        {
+            Trace::Scope scope{"Trace/Global"};
+        }
+
+        std::ostringstream report;
+        Trace::Report(report);
+        CHECK(report.str().find("Trace/Global") != std::string::npos);
+
+        Trace::Reset();
+        CHECK(Trace::GlobalCounters().Allocations == 0 && Trace::Summaries().empty());
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Trace/ScopeDeltas",               ScopeDeltas},
+        {"Trace/PeakRestore",               PeakRestore},
+        {"Trace/CallSites",                 CallSites},
+        {"Trace/ReleasedCells",             ReleasedCells},
+        {"Trace/GlobalCounters",            GlobalCounters},
+    });
+}
\ No newline at end of file
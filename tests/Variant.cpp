@@ -0,0 +1,279 @@
+#include "Check.hpp"
+
+#include <thread>
+
+
+using namespace mxl;
+
+
+namespace
+{
+    template <typename _Ty>
+    bool Holds(const Variant& value, const _Ty expected)
+    {
+        return value.TypeID() == Type::GetID<_Ty>() && static_cast<const _Ty&>(value) == expected;
+    }
+
+
+    void Promotion()
+    {
+        const Variant integer{(int16_t)3}, longValue{(int32_t)7}, single{1.5f}, real{2.5};
+
+        CHECK(Holds(integer + real, 5.5));
+        CHECK(Holds(integer + longValue, (int32_t)10));
+        CHECK(Holds(integer + single, 4.5f));
+        CHECK((longValue + single).TypeID() == Type::ID::Double);
+        CHECK((Variant{(int64_t)1} * single).TypeID() == Type::ID::Double);
+
+        // '/' always gives a floating point quotient
+        CHECK(Holds(longValue / integer, 7.0 / 3));
+        CHECK((integer / single).TypeID() == Type::ID::Float);
+        CHECK(Holds(Variant{(int32_t)6} / Variant{(int32_t)3}, 2.0));
+
+        // Unary minus keeps the type
+        CHECK(Holds(-integer, (int16_t)-3));
+
+        Variant accumulator{(int16_t)1};
+        accumulator += 2.5;
+        CHECK(Holds(accumulator, 3.5));
+    }
+
+
+    void EmptyOperands()
+    {
+        const Variant empty, text{u"abc"};
+
+        CHECK(empty == 0);
+        CHECK(empty == Variant{0.0});
+        CHECK(empty == empty);
+        CHECK(!(empty < empty));
+        CHECK(empty < Variant{1.0});
+        CHECK(Holds(empty + Variant{(int16_t)4}, (int16_t)4));
+        CHECK(Holds(empty * Variant{2.5}, 0.0));
+
+        // Next to a String, Empty is ""
+        CHECK((empty + text).IsString());
+        CHECK((text + empty).IsString());
+        CHECK(empty == Variant{u""});
+        CHECK(empty < text);
+        CHECK(text > empty);
+    }
+
+
+    void OverflowWidensToDouble()
+    {
+        CHECK(Holds(Variant{(int16_t)32000} + Variant{(int16_t)1000}, 33000.0));
+        CHECK(Holds(Variant{(int16_t)-32768} - Variant{(int16_t)1}, -32769.0));
+        CHECK(Holds(Variant{(int32_t)INT32_MAX} * Variant{(int32_t)2}, 2.0 * INT32_MAX));
+        CHECK((Variant{(int64_t)INT64_MAX} + Variant{(int64_t)1}).TypeID() == Type::ID::Double);
+        CHECK((Variant{(int64_t)INT64_MIN} - Variant{(int64_t)1}).TypeID() == Type::ID::Double);
+        CHECK((Variant{(int64_t)1 << 40} * Variant{(int64_t)1 << 30}).TypeID() == Type::ID::Double);
+
+        // In range, the integer type is kept
+        CHECK(Holds(Variant{(int64_t)1 << 20} * Variant{(int64_t)1 << 30}, (int64_t)1 << 50));
+        CHECK(Holds(Variant{(int16_t)100} * Variant{(int16_t)100}, (int16_t)10000));
+    }
+
+
+    void PrimitiveOperands()
+    {
+        const Variant four{4.0}, three{(int16_t)3};
+
+        CHECK(10.0 - four == 6.0);
+        CHECK(four - 10.0 == -6.0);
+        CHECK(8.0 / four == 2.0);
+        CHECK(1.0 + four == 5.0);
+        CHECK(Holds(three - 0.5, 2.5));
+        CHECK(Holds(three * 2, (int32_t)6));
+
+        // The primitive side is promoted just as a Variant would be
+        CHECK(Holds(2.0 * three, 6.0));
+        CHECK(Holds(10.0 - three, 7.0));
+        CHECK(Holds((int16_t)32000 + Variant{(int16_t)1000}, 33000.0));
+        CHECK(Holds(1 + Variant{}, (int32_t)1));
+
+        // ... and errors come back as values rather than traps
+        CHECK((int32_t{1} / Variant{(int32_t)0}).Error() == CellError::Div0);
+        CHECK((1.0 + Variant{CellError::NA}).Error() == CellError::NA);
+        CHECK((2 * Variant{u"x"}).Error() == CellError::Value);
+
+        double total = 1.0;
+        total += four;
+        total -= Variant{0.5};
+        CHECK(total == 4.5);
+
+        // Compound forms store back like CInt: half to even, and must fit
+        int32_t count = 1;
+        count += Variant{2.5};
+        CHECK(count == 4);
+        count *= three;
+        CHECK(count == 12);
+        CHECK_THROWS(count /= Variant{(int32_t)0});
+        int16_t small = 32767;
+        CHECK_THROWS(small += three);
+
+        CHECK(3 == three);
+        CHECK(2.0 < Variant{2.5});
+        CHECK(three + 1.5 == 4.5);
+        CHECK(4 != three);
+    }
+
+
+    void ErrorValues()
+    {
+        const Variant na{CellError::NA}, one{1.0}, zero{(int32_t)0}, empty, text{u"x"};
+
+        CHECK(na.IsError() && na.Error() == CellError::NA);
+        CHECK((one + na).Error() == CellError::NA);
+        CHECK((na * one).Error() == CellError::NA);
+        CHECK((Variant{CellError::Div0} + na).Error() == CellError::Div0);
+        CHECK((one / zero).Error() == CellError::Div0);
+        CHECK((one / empty).Error() == CellError::Div0);
+        CHECK((text + one).Error() == CellError::Value);
+        CHECK((text + text).Error() == CellError::Value);
+        CHECK((-na).IsError());
+        CHECK_THROWS(one.Error());
+
+        CHECK(na == Variant{CellError::NA});
+        CHECK(!(na == Variant{CellError::Div0}));
+        CHECK(!(na == one) && na != one && !(na < one) && !(na > one));
+
+        std::ostringstream os;
+        os << na;
+        CHECK(os.str() == "#N/A");
+
+        const Variant nan{std::nan("")};
+        CHECK(!(nan == nan) && nan != nan);
+    }
+
+
+    void BoolByteAndDate()
+    {
+        CHECK(Holds(Variant{Date{45000.0}} + Variant{1.0}, 45001.0));
+        CHECK(Holds(Variant{Byte{3}} * Variant{2.0}, 6.0));
+        CHECK(Variant{Bool{true}} == Variant{Bool{true}});
+        CHECK(Variant{Bool{false}} == Variant{});
+
+        // A Boolean is an Integer -1/0
+        CHECK(Variant{Bool{true}} < Variant{Bool{false}});
+        CHECK(Holds(Variant{Bool{true}} + Variant{Bool{true}}, (int16_t)-2));
+
+        // Byte is the narrowest integer
+        CHECK(Holds(Variant{Byte{200}} + Variant{Byte{50}}, Byte{250}));
+        CHECK(Holds(Variant{Byte{200}} + Variant{Byte{100}}, 300.0));
+        CHECK(Holds(Variant{Byte{2}} + Variant{(int32_t)5}, (int32_t)7));
+        CHECK((Variant{Byte{2}} * Variant{1.5f}).TypeID() == Type::ID::Float);
+
+        CHECK(Variant{Date{2.0}} > Variant{Byte{1}});
+        CHECK((Variant{Bool{true}} + Variant{CellError::NA}).Error() == CellError::NA);
+        CHECK((Variant{Date{1.0}} + Variant{u"x"}).Error() == CellError::Value);
+    }
+
+
+    void ThrowingPairs()
+    {
+        const Variant array{Array<double>(2, 1)}, na{CellError::NA}, one{1.0}, text{u"x"};
+
+        // An error next to an Array still passes through
+        CHECK((na + array).Error() == CellError::NA);
+        CHECK((array + na).Error() == CellError::NA);
+        CHECK(!(na == array));
+
+        CHECK_THROWS(array + one);
+        CHECK_THROWS(array == array);
+        CHECK_THROWS(one < text);
+        CHECK_THROWS(Variant{Bool{true}} == text);
+    }
+
+
+    void TryAsAndExceptions()
+    {
+        Variant real{2.5}, integer{(int32_t)3}, text{u"hi"};
+
+        auto access = real.TryAs<double>();
+        CHECK(access && *access == 2.5);
+
+        CHECK(!integer.TryAs<double>());
+        CHECK(!text.TryAs<double>());
+        CHECK_THROWS(text.TryAs<double>().Value());
+
+        double fallback = 9;
+        CHECK(&integer.TryAs<double>().ValueOr(fallback) == &fallback);
+
+        const Exception e{"boom", "here"};
+        const Exception copy{e};
+        CHECK(std::string_view{e.what()} == "[MinXL] Exception: boom (at here)");
+        CHECK(std::string_view{copy.what()} == e.what());
+
+        // The text is formatted up front, so threads may read a shared exception
+        const auto shared = std::make_exception_ptr(Exception{"shared", "there"});
+        std::string seen[2];
+
+        std::thread readers[2];
+
+        for (int i = 0; i < 2; i++)
+        {
+            readers[i] = std::thread{[&, i]
+            {
+                try
+                {
+                    std::rethrow_exception(shared);
+                }
+                catch (const Exception& e)
+                {
+                    seen[i] = e.what();
+                }
+            }};
+        }
+
+        for (auto& reader : readers)
+            reader.join();
+
+        CHECK(seen[0] == "[MinXL] Exception: shared (at there)" && seen[1] == seen[0]);
+    }
+
+
+    void IncrementAndDecrement()
+    {
+        // ++ and -- are += 1 and -= 1, so they promote and widen the same way
+        Variant value{(int16_t)32767};
+        CHECK(Holds(++value, 32768.0));
+
+        value = Variant{(int16_t)-32768};
+        CHECK(Holds(value--, (int16_t)-32768) && Holds(value, -32769.0));
+
+        value = Variant{};
+        CHECK(Holds(++value, (int16_t)1));
+
+        value = Variant{Bool{true}};
+        CHECK(Holds(++value, (int16_t)0));
+
+        value = Variant{Byte{255}};
+        CHECK(Holds(++value, (int16_t)256));
+
+        value = Variant{Date{45000.0}};
+        CHECK(Holds(--value, 44999.0));
+
+        value = Variant{CellError::NA};
+        CHECK((++value).Error() == CellError::NA);
+
+        value = Variant{u"x"};
+        CHECK((value++).IsString() && value.Error() == CellError::Value);
+    }
+}
+
+
+int main()
+{
+    return test::Run({
+        {"Variant/Promotion",               Promotion},
+        {"Variant/EmptyOperands",           EmptyOperands},
+        {"Variant/OverflowWidensToDouble",  OverflowWidensToDouble},
+        {"Variant/PrimitiveOperands",       PrimitiveOperands},
+        {"Variant/ErrorValues",             ErrorValues},
+        {"Variant/BoolByteAndDate",         BoolByteAndDate},
+        {"Variant/ThrowingPairs",           ThrowingPairs},
+        {"Variant/TryAsAndExceptions",      TryAsAndExceptions},
+        {"Variant/IncrementAndDecrement",   IncrementAndDecrement},
+    });
+}
\ No newline at end of file